@@ -199,6 +199,33 @@ vec3d Bezier_curve::LastPnt() const
     return p;
 }
 
+//==== Average of All Control Points - Unchanged By FlipCurve ====//
+vec3d Bezier_curve::ControlPntCenter() const
+{
+    vec3d sum;
+    int cnt = 0;
+
+    int nsect = m_Curve.number_segments();
+    for ( int i = 0; i < nsect; i++ )
+    {
+        curve_segment_type c;
+        m_Curve.get( c, i );
+
+        for ( int j = 0; j <= c.degree(); j++ )
+        {
+            curve_point_type cp = c.get_control_point( j );
+            sum = sum + vec3d( cp.x(), cp.y(), cp.z() );
+            cnt++;
+        }
+    }
+
+    if ( cnt > 0 )
+    {
+        sum = sum * ( 1.0 / ( double )cnt );
+    }
+    return sum;
+}
+
 void Bezier_curve::UWCurveToXYZCurve( const Surf *srf )
 {
     int nsect = m_Curve.number_segments();
@@ -55,6 +55,7 @@ public:
 
     vec3d FirstPnt() const;
     vec3d LastPnt() const;
+    vec3d ControlPntCenter() const;
 
     vec3d CompPnt01( double u ) const;
 
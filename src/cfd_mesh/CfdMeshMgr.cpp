@@ -12,6 +12,9 @@
 //#include "feaStructScreen.h"
 #include "Util.h"
 #include "SubSurfaceMgr.h"
+#include "BndBoxTree.h"
+#include "ParallelUtil.h"
+#include "ResultsMgr.h"
 
 #ifdef DEBUG_CFD_MESH
 #include <direct.h>
@@ -364,6 +367,9 @@ CfdMeshMgrSingleton::CfdMeshMgrSingleton() : ParmContainer()
 
     m_MeshInProgress = false;
 
+    m_NumRemeshEdgeVisits = m_NumRemeshSplits = m_NumRemeshCollapses = 0;
+    m_RemeshPeakMemory = 0;
+
 #ifdef DEBUG_CFD_MESH
     m_DebugDir  = Stringc( "MeshDebug/" );
     _mkdir( m_DebugDir.get_char_star() );
@@ -399,6 +405,10 @@ void CfdMeshMgrSingleton::GenerateMesh()
 {
     m_MeshInProgress = true;
 
+    m_Profile.Clear();
+    m_SurfReusedVec.clear();
+    StartProfileStage( "FetchSurfs" );
+
     CfdMeshMgr.addOutputText( "Fetching Bezier Surfaces\n" );
 
     vector< XferSurf > xfersurfs;
@@ -413,28 +423,40 @@ void CfdMeshMgrSingleton::GenerateMesh()
     if ( m_SurfVec.size() == 0 )
     {
         CfdMeshMgr.addOutputText( "No Surfaces To Mesh\n" );
+        EndProfileStage();
+        FinishProfile( "CFDMesh_Profile", CfdMeshMgrSingleton::CFD_OUTPUT );
         return;
     }
 
     CfdMeshMgr.UpdateSourcesAndWakes();
     CfdMeshMgr.UpdateDomain();
     CfdMeshMgr.BuildDomain();
+    EndProfileStage();
 
+    StartProfileStage( "BuildGrid" );
     CfdMeshMgr.addOutputText( "Build Grid\n" );
     CfdMeshMgr.BuildGrid();
+    EndProfileStage();
 
+    StartProfileStage( "Intersect" );
     CfdMeshMgr.addOutputText( "Intersect\n" );
     CfdMeshMgr.Intersect();
     CfdMeshMgr.addOutputText( "Finished Intersect\n" );
+    EndProfileStage();
 
+    StartProfileStage( "BuildTargetMap" );
     CfdMeshMgr.addOutputText( "Build Target Map\n" );
     CfdMeshMgr.BuildTargetMap( CfdMeshMgrSingleton::CFD_OUTPUT );
+    EndProfileStage();
 
+    StartProfileStage( "InitMesh" );
     CfdMeshMgr.addOutputText( "InitMesh\n" );
     CfdMeshMgr.InitMesh( );
 
     CfdMeshMgr.SubTagTris();
+    EndProfileStage();
 
+    StartProfileStage( "Remesh" );
     CfdMeshMgr.addOutputText( "Remesh\n" );
     CfdMeshMgr.Remesh( CfdMeshMgrSingleton::CFD_OUTPUT );
 
@@ -443,13 +465,20 @@ void CfdMeshMgrSingleton::GenerateMesh()
     //addOutputText( qual.get_char_star() );
 
     SubSurfaceMgr.BuildSingleTagMap();
+    EndProfileStage();
 
+    StartProfileStage( "ExportFiles" );
     CfdMeshMgr.addOutputText( "Exporting Files\n" );
     CfdMeshMgr.ExportFiles();
+    EndProfileStage();
 
+    StartProfileStage( "CheckWaterTight" );
     CfdMeshMgr.addOutputText( "Check Water Tight\n" );
     string resultTxt = CfdMeshMgr.CheckWaterTight();
     CfdMeshMgr.addOutputText( resultTxt.c_str() );
+    EndProfileStage();
+
+    FinishProfile( "CFDMesh_Profile", CfdMeshMgrSingleton::CFD_OUTPUT );
 
 //  addOutputText( "Mesh Complete\n");
 
@@ -807,6 +836,7 @@ void CfdMeshMgrSingleton::UpdateSourcesAndWakes()
             }
         }
     }
+    GetGridDensityPtr()->BuildSourceTree();
 
     m_WakeMgr.SetLeadingEdges( wake_leading_edges );
     m_Vehicle->UpdateBBox();
@@ -1120,7 +1150,7 @@ void CfdMeshMgrSingleton::DeleteDuplicateSurfs()
 void CfdMeshMgrSingleton::BuildGrid()
 {
 
-    int i, j;
+    int i;
     vector< SCurve* > scurve_vec;
     for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
@@ -1130,19 +1160,36 @@ void CfdMeshMgrSingleton::BuildGrid()
         m_SurfVec[i]->LoadSCurves( scurve_vec );
     }
 
+    //==== Matching Curves Have Control Points Within ICurve::Match Tol - So Do Their Centers ====//
+    double match_tol = 1.0e-5;
+    vector< BndBox > center_box_vec( scurve_vec.size() );
     for ( i = 0 ; i < ( int )scurve_vec.size() ; i++ )
     {
-        for ( j = i + 1 ; j < ( int )scurve_vec.size() ; j++ )
+        Bezier_curve xyzcrv = scurve_vec[i]->GetUWCrv();
+        xyzcrv.UWCurveToXYZCurve( scurve_vec[i]->GetSurf() );
+
+        vec3d cen = xyzcrv.ControlPntCenter();
+        center_box_vec[i].Update( cen - vec3d( match_tol, match_tol, match_tol ) * 0.5 );
+        center_box_vec[i].Update( cen + vec3d( match_tol, match_tol, match_tol ) * 0.5 );
+    }
+
+    BndBoxTree center_tree;
+    center_tree.Build( center_box_vec );
+
+    vector< pair< int, int > > cand_pair_vec;
+    center_tree.FindOverlapPairs( cand_pair_vec );
+
+    //==== Candidates Are Tested In The Same i < j Order As An All Pairs Loop ====//
+    for ( int k = 0 ; k < ( int )cand_pair_vec.size() ; k++ )
+    {
+        ICurve* icrv = new ICurve;
+        if ( icrv->Match( scurve_vec[ cand_pair_vec[k].first ], scurve_vec[ cand_pair_vec[k].second ] ) )
         {
-            ICurve* icrv = new ICurve;
-            if ( icrv->Match( scurve_vec[i], scurve_vec[j] ) )
-            {
-                m_ICurveVec.push_back( icrv );
-            }
-            else
-            {
-                delete icrv;
-            }
+            m_ICurveVec.push_back( icrv );
+        }
+        else
+        {
+            delete icrv;
         }
     }
 
@@ -1185,7 +1232,7 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
     int i;
     for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        m_SurfVec[i]->BuildTargetMap( allsources, i );
+        m_SurfVec[i]->BuildTargetMap( allsources, i, GetNumThreads() );
         m_SurfVec[i]->LimitTargetMap();
     }
 
@@ -1277,84 +1324,280 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
 void CfdMeshMgrSingleton::Remesh( int output_type )
 {
     char str[256];
-    int total_num_tris = 0;
+
+    vector< bool > remesh_flags( m_SurfVec.size(), true );
+    int total_num_tris = RemeshSurfs( remesh_flags, true, GetCfdSettingsPtr()->GetReuseMeshFlag(), output_type );
+
+    m_WakeMgr.StretchWakes();
+
+    sprintf( str, "Total Num Tris = %d\n", total_num_tris );
+    addOutputText( str, output_type );
+}
+
+void CfdMeshMgrSingleton::RemeshSingleComp( int comp_id, int output_type )
+{
+    char str[256];
+
+    vector< bool > remesh_flags( m_SurfVec.size(), false );
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        remesh_flags[i] = ( m_SurfVec[i]->GetCompID() == comp_id );
+    }
+
+    int total_num_tris = RemeshSurfs( remesh_flags, false, false, output_type );
+
+    sprintf( str, "Total Num Tris = %d\n", total_num_tris );
+    addOutputText( str, output_type );
+}
+
+//==== Remesh Flagged Surfs - Each Surf Owns Its Mesh So Surfs Are Remeshed Concurrently ====//
+int CfdMeshMgrSingleton::RemeshSurfs( const vector< bool > & remesh_flags, bool rem_rev_flag, bool use_cache, int output_type )
+{
     int nsurf = ( int )m_SurfVec.size();
+
+    //==== Surfs With Unchanged Inputs Take Their Tris From The Last Run ====//
+    if ( !use_cache )
+    {
+        m_MeshCache.clear();
+    }
+    vector< unsigned long long > surf_hash_vec( nsurf, 0 );
+    vector< char > surf_reused_vec( nsurf, 0 );
+    vector< int > surf_num_rev( nsurf, 0 );
+
+    //==== Progress Text Is Buffered Per Surf and Output In Surf Order ====//
+    vector< string > surf_text_vec( nsurf );
+    vector< bool > surf_done_vec( nsurf, false );
+    vector< int > surf_num_tris( nsurf, 0 );
+    int next_output = 0;
+
+    int remesh_mode = GetCfdSettingsPtr()->GetQueueRemeshFlag() ? Mesh::REMESH_QUEUE : Mesh::REMESH_SWEEP;
+
+    #pragma omp parallel for schedule( dynamic ) num_threads( GetNumThreads() )
     for ( int i = 0 ; i < nsurf ; ++i )
     {
-        int num_tris = 0;
+        char str[256];
+        string surf_text;
 
-        int num_rev_removed = 0;
+        map< unsigned long long, CachedSurfMesh >::const_iterator cache_iter = m_MeshCache.end();
+        if ( remesh_flags[i] && use_cache )
+        {
+            surf_hash_vec[i] = m_SurfVec[i]->ComputeMeshHash( remesh_mode, rem_rev_flag );
+            cache_iter = m_MeshCache.find( surf_hash_vec[i] );
+        }
 
-        for ( int iter = 0 ; iter < 10 ; ++iter )
+        if ( cache_iter != m_MeshCache.end() )
         {
-            num_tris = 0;
-            m_SurfVec[i]->GetMesh()->Remesh();
+            const CachedSurfMesh & cached = cache_iter->second;
+            m_SurfVec[i]->GetMesh()->GetSimpPntVec() = cached.m_PntVec;
+            m_SurfVec[i]->GetMesh()->GetSimpUWPntVec() = cached.m_UWPntVec;
+            m_SurfVec[i]->GetMesh()->GetSimpTriVec() = cached.m_TriVec;
+            surf_num_tris[i] = ( int )cached.m_TriVec.size();
+            surf_num_rev[i] = cached.m_NumRevRemoved;
+            surf_reused_vec[i] = 1;
 
-            num_rev_removed = m_SurfVec[i]->GetMesh()->RemoveRevTris();
+            sprintf( str, "Surf %d/%d Reused Num Tris = %d\n", i + 1, nsurf, surf_num_tris[i] );
+            surf_text += str;
+
+            if ( cached.m_NumRevRemoved > 0 )
+            {
+                sprintf( str, "%d Reversed tris collapsed in final iteration.\n", cached.m_NumRevRemoved );
+                surf_text += str;
+            }
+        }
+        else if ( remesh_flags[i] )
+        {
+            int num_tris = 0;
+            int num_rev_removed = 0;
+
+            m_SurfVec[i]->GetMesh()->ClearRemeshCounts();
+            for ( int iter = 0 ; iter < 10 ; ++iter )
+            {
+                m_SurfVec[i]->GetMesh()->Remesh( remesh_mode );
+
+                if ( rem_rev_flag )
+                {
+                    num_rev_removed = m_SurfVec[i]->GetMesh()->RemoveRevTris();
+                }
 
+                num_tris = m_SurfVec[i]->GetMesh()->GetNumTris();
 
-            num_tris += m_SurfVec[i]->GetMesh()->GetTriList().size();
+                sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
+                surf_text += str;
+            }
+            surf_num_tris[i] = num_tris;
+            surf_num_rev[i] = num_rev_removed;
 
-            sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
-            if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT )
+            if ( num_rev_removed > 0 )
             {
-                addOutputText( str, output_type );
+                sprintf( str, "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
+                surf_text += str;
             }
         }
-        total_num_tris += num_tris;
 
-        if ( num_rev_removed > 0 )
+        if ( !surf_reused_vec[i] )
+        {
+            m_SurfVec[i]->GetMesh()->LoadSimpTris();
+        }
+        m_SurfVec[i]->GetMesh()->Clear();
+
+        #pragma omp critical ( CfdMeshMgr_RemeshOutput )
         {
-            sprintf( str, "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
-            if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT )
+            surf_text_vec[i] = surf_text;
+            surf_done_vec[i] = true;
+
+            while ( next_output < nsurf && surf_done_vec[next_output] )
             {
-                addOutputText( str, output_type );
+                if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT && !surf_text_vec[next_output].empty() )
+                {
+                    addOutputText( surf_text_vec[next_output], output_type );
+                }
+                next_output++;
             }
         }
+    }
 
-        m_SurfVec[i]->GetMesh()->LoadSimpTris();
-        m_SurfVec[i]->GetMesh()->Clear();
-        m_SurfVec[i]->Subtag( GetCfdSettingsPtr()->GetIntersectSubSurfs() );
+    //==== Keep Only This Run's Surfs - Stored Before Tags Are Added ====//
+    if ( use_cache )
+    {
+        int num_reused = 0;
+        map< unsigned long long, CachedSurfMesh > mesh_cache;
+        for ( int i = 0 ; i < nsurf ; ++i )
+        {
+            if ( !remesh_flags[i] )
+            {
+                continue;
+            }
+
+            CachedSurfMesh & cached = mesh_cache[ surf_hash_vec[i] ];
+            if ( surf_reused_vec[i] )
+            {
+                cached = m_MeshCache[ surf_hash_vec[i] ];
+                num_reused++;
+            }
+            else
+            {
+                cached.m_PntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+                cached.m_UWPntVec = m_SurfVec[i]->GetMesh()->GetSimpUWPntVec();
+                cached.m_TriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
+                cached.m_NumRevRemoved = surf_num_rev[i];
+            }
+        }
+        m_MeshCache.swap( mesh_cache );
+
+        if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT )
+        {
+            char str[256];
+            sprintf( str, "Reused %d of %d Surf Meshes\n", num_reused, nsurf );
+            addOutputText( str, output_type );
+        }
+    }
+    m_SurfReusedVec.assign( surf_reused_vec.begin(), surf_reused_vec.end() );
+
+    //==== Subtagging Adds To Global Tag Combos ====//
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        m_SurfVec[i]->Subtag( GetCfdSettingsPtr()->GetIntersectSubSurfs(), GetNumThreads() );
+    }
+
+    #pragma omp parallel for schedule( dynamic ) num_threads( GetNumThreads() )
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
         m_SurfVec[i]->GetMesh()->CondenseSimpTris();
     }
 
-    m_WakeMgr.StretchWakes();
+    int total_num_tris = 0;
+    size_t total_mem = 0;
+    m_NumRemeshEdgeVisits = m_NumRemeshSplits = m_NumRemeshCollapses = 0;
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        total_num_tris += surf_num_tris[i];
+        if ( remesh_flags[i] )
+        {
+            total_mem += m_SurfVec[i]->GetMesh()->GetPeakMemorySize();
+        }
+        if ( remesh_flags[i] && !surf_reused_vec[i] )
+        {
+            m_NumRemeshEdgeVisits += m_SurfVec[i]->GetMesh()->GetNumEdgeVisits();
+            m_NumRemeshSplits += m_SurfVec[i]->GetMesh()->GetNumSplits();
+            m_NumRemeshCollapses += m_SurfVec[i]->GetMesh()->GetNumCollapses();
+        }
+    }
+    m_RemeshPeakMemory = total_mem;
 
-    sprintf( str, "Total Num Tris = %d\n", total_num_tris );
-    addOutputText( str, output_type );
+    if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT )
+    {
+        char str[256];
+        sprintf( str, "Peak Mesh Memory = %.1f KB\n", total_mem / 1024.0 );
+        addOutputText( str, output_type );
+        sprintf( str, "Remesh Edge Visits = %d Splits = %d Collapses = %d\n",
+                 m_NumRemeshEdgeVisits, m_NumRemeshSplits, m_NumRemeshCollapses );
+        addOutputText( str, output_type );
+    }
+
+    return total_num_tris;
 }
 
-void CfdMeshMgrSingleton::RemeshSingleComp( int comp_id, int output_type )
+void CfdMeshMgrSingleton::StartProfileStage( const string & name )
 {
-    char str[256];
-    int total_num_tris = 0;
-    int nsurf = ( int )m_SurfVec.size();
-    for ( int i = 0 ; i < nsurf ; i++ )
+    m_Profile.StartStage( name );
+}
+
+//==== Record Element Counts As The Stage Leaves Them ====//
+void CfdMeshMgrSingleton::EndProfileStage()
+{
+    int num_tris = 0;
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        int num_tris = 0;
-        if ( m_SurfVec[i]->GetCompID() == comp_id )
-        {
-            for ( int iter = 0 ; iter < 10 ; iter++ )
-            {
-                num_tris = 0;
-                m_SurfVec[i]->GetMesh()->Remesh();
+        num_tris += m_SurfVec[i]->GetMesh()->GetNumTris();
+        num_tris += ( int )m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
+    }
 
-                num_tris += m_SurfVec[i]->GetMesh()->GetTriList().size();
+    m_Profile.EndStage( ( int )m_SurfVec.size(), ( int )m_ISegChainList.size(), num_tris );
+}
 
-                sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
-                addOutputText( str, output_type );
+void CfdMeshMgrSingleton::FinishProfile( const string & res_name, int output_type )
+{
+    string res_id = m_Profile.CreateResults( res_name );
+
+    Results* res = ResultsMgr.FindResultsPtr( res_id );
+    if ( res )
+    {
+        res->Add( NameValData( "Remesh_Edge_Visits", m_NumRemeshEdgeVisits ) );
+        res->Add( NameValData( "Remesh_Splits", m_NumRemeshSplits ) );
+        res->Add( NameValData( "Remesh_Collapses", m_NumRemeshCollapses ) );
+        res->Add( NameValData( "Remesh_Peak_Memory_KB", m_RemeshPeakMemory / 1024.0 ) );
+
+        //==== Which Surfs Were Reused, By Owning Geom ====//
+        if ( m_SurfReusedVec.size() == m_SurfVec.size() )
+        {
+            vector< string > geom_id_vec( m_SurfVec.size() );
+            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+            {
+                geom_id_vec[i] = m_SurfVec[i]->GetGeomID();
             }
-            total_num_tris += num_tris;
+            res->Add( NameValData( "Surf_Geom_ID", geom_id_vec ) );
+            res->Add( NameValData( "Surf_Reused", m_SurfReusedVec ) );
         }
+    }
 
-        m_SurfVec[i]->GetMesh()->LoadSimpTris();
-        m_SurfVec[i]->GetMesh()->Clear();
-        m_SurfVec[i]->Subtag( GetCfdSettingsPtr()->GetIntersectSubSurfs() );
-        m_SurfVec[i]->GetMesh()->CondenseSimpTris();
+    if ( !m_TraceFileName.empty() && !m_Profile.WriteChromeTrace( m_TraceFileName ) )
+    {
+        if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT )
+        {
+            addOutputText( "Could Not Write Trace File " + m_TraceFileName + "\n", output_type );
+        }
     }
+}
 
-    sprintf( str, "Total Num Tris = %d\n", total_num_tris );
-    addOutputText( str, output_type );
+//==== Number of Threads For Parallel Mesh Stages ====//
+int CfdMeshMgrSingleton::GetNumThreads()
+{
+    int num_threads = GetCfdSettingsPtr()->GetNumThreads();
+    if ( num_threads < 1 )
+    {
+        num_threads = GetMaxNumThreads();
+    }
+    return num_threads;
 }
 
 string CfdMeshMgrSingleton::GetQualString()
@@ -1471,7 +1714,7 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
     }
 
     //==== Build Map ====//
-    map< int, vector< int > > indMap;
+    PntHash indMap;
     vector< int > pntShift;
     BuildIndMap( allPntVec, indMap, pntShift );
 
@@ -1483,9 +1726,9 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
         vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
         for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
         {
-            int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-            int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-            int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
+            int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], indMap );
+            int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], indMap );
+            int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], indMap );
             SimpTri stri;
             stri.ind0 = pntShift[i0];
             stri.ind1 = pntShift[i1];
@@ -1603,7 +1846,7 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
     }
 
     //==== Build Map ====//
-    map< int, vector< int > > indMap;
+    PntHash indMap;
     vector< int > pntShift;
     int numPnts = BuildIndMap( allPntVec, indMap, pntShift );
 
@@ -1630,9 +1873,9 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
         vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
         for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
         {
-            int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-            int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-            int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
+            int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], indMap );
+            int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], indMap );
+            int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], indMap );
             int ind1 = pntShift[i0] + 1;
             int ind2 = pntShift[i1] + 1;
             int ind3 = pntShift[i2] + 1;
@@ -1755,12 +1998,12 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     }
 
     //==== Build Map ====//
-    map< int, vector< int > > indMap;
+    PntHash indMap;
     vector< int > pntShift;
     BuildIndMap( allPntVec, indMap, pntShift );
 
     //==== Build Wake Map If Available ====//
-    map< int, vector< int > > wakeIndMap;
+    PntHash wakeIndMap;
     vector< int > wakePntShift;
     int wakeNumPnts = 0;
     if ( wakeAllPntVec.size() )
@@ -1779,9 +2022,9 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
             vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
+                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], indMap );
+                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], indMap );
+                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], indMap );
                 SimpTri stri;
                 stri.ind0 = pntShift[i0] + 1;
                 stri.ind1 = pntShift[i1] + 1;
@@ -1812,9 +2055,9 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
             vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], wakeAllPntVec, wakeIndMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], wakeAllPntVec, wakeIndMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], wakeAllPntVec, wakeIndMap );
+                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], wakeIndMap );
+                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], wakeIndMap );
+                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], wakeIndMap );
                 SimpTri stri;
                 stri.ind0 = wakePntShift[i0] + 1 + wakeIndOffset;
                 stri.ind1 = wakePntShift[i1] + 1 + wakeIndOffset;
@@ -2176,7 +2419,7 @@ string CfdMeshMgrSingleton::CheckWaterTight()
     }
 
     //==== Build Map ====//
-    map< int, vector< int > > indMap;
+    PntHash indMap;
     vector< int > pntShift;
     BuildIndMap( allPntVec, indMap, pntShift );
 
@@ -2202,9 +2445,9 @@ string CfdMeshMgrSingleton::CheckWaterTight()
             vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
+                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], indMap );
+                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], indMap );
+                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], indMap );
                 int ind1 = pntShift[i0];
                 int ind2 = pntShift[i1];
                 int ind3 = pntShift[i2];
@@ -2318,90 +2561,37 @@ Edge* CfdMeshMgrSingleton::FindAddEdge( map< int, vector<Edge*> > & edgeMap, vec
     return e;
 }
 
-int CfdMeshMgrSingleton::BuildIndMap( vector< vec3d* > & allPntVec, map< int, vector< int > >& indMap, vector< int > & pntShift )
+int CfdMeshMgrSingleton::BuildIndMap( vector< vec3d* > & allPntVec, PntHash& indMap, vector< int > & pntShift )
 {
-//double max_dist = 0.0;
-    double tol = 1.0e-12;
-    map<int, vector<int> >::const_iterator iter;
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
-    {
-        int combind = ( int )( ( allPntVec[i]->x() + allPntVec[i]->y() + allPntVec[i]->z() ) * 10000.0 );
-        iter = indMap.find( combind );
-        if ( iter == indMap.end() ) // Add Index
-        {
-            indMap[combind].push_back( i );
-        }
-        else
-        {
-            bool addIndexFlag = true;
-            for ( int j = 0 ; j < ( int )iter->second.size() ; j++ )
-            {
-                int testind = iter->second[j];
-
-                if ( fabs( allPntVec[i]->x() - allPntVec[testind]->x() ) < tol  &&
-                        fabs( allPntVec[i]->y() - allPntVec[testind]->y() ) < tol  &&
-                        fabs( allPntVec[i]->z() - allPntVec[testind]->z() ) < tol  )
-                {
-                    addIndexFlag = false;
-                }
-            }
-            if ( addIndexFlag )
-            {
-                indMap[combind].push_back( i );
-            }
-        }
-    }
+    indMap.Build( allPntVec, 1.0e-12 );
 
     //==== Figure Out Point Shifts ====//
     pntShift.resize( allPntVec.size() );
-    for ( int i = 0 ; i < ( int )pntShift.size() ; i++ )
-    {
-        pntShift[i] = -999;
-    }
-
-    for ( iter = indMap.begin() ; iter != indMap.end() ; iter++ )
-    {
-        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
-        {
-            int ind = iter->second[i];
-            pntShift[ind] = 1;
-        }
-    }
 
     int cnt = 0;
     for ( int i = 0 ; i < ( int )pntShift.size() ; i++ )
     {
-        if ( pntShift[i] > 0 )
+        if ( indMap.IsUnique( i ) )
         {
             pntShift[i] = cnt;
             cnt++;
         }
+        else
+        {
+            pntShift[i] = -999;
+        }
     }
 
     return cnt;
 
 }
 
-int  CfdMeshMgrSingleton::FindPntIndex(  vec3d& pnt, vector< vec3d* > & allPntVec, map< int, vector< int > >& indMap )
+int  CfdMeshMgrSingleton::FindPntIndex(  vec3d& pnt, PntHash& indMap )
 {
-    double tol = 1.0e-12;
-    map<int, vector<int> >::const_iterator iter;
-
-    int combind = ( int )( ( pnt.x() + pnt.y() + pnt.z() ) * 10000.0 );
-    iter = indMap.find( combind );
-    if ( iter != indMap.end() )
+    int ind = indMap.FindMatch( pnt );
+    if ( ind >= 0 )
     {
-        for ( int j = 0 ; j < ( int )iter->second.size() ; j++ )
-        {
-            int testind = iter->second[j];
-
-            if ( fabs( pnt.x() - allPntVec[testind]->x() ) < tol  &&
-                    fabs( pnt.y() - allPntVec[testind]->y() ) < tol  &&
-                    fabs( pnt.z() - allPntVec[testind]->z() ) < tol  )
-            {
-                return testind;
-            }
-        }
+        return ind;
     }
 
     printf( "Error: CfdMeshMgr.FindPntIndex can't find index\n" );
@@ -2421,12 +2611,46 @@ void CfdMeshMgrSingleton::Intersect()
 
     if ( GetCfdSettingsPtr()->GetIntersectSubSurfs() ) BuildSubSurfIntChains();
 
-    //==== Quad Tree Intersection - Intersection Segments Get Loaded at AddIntersectionSeg ===//
+    //==== Broad Phase - Only Surfs With Overlapping Bounding Boxes Can Intersect ====//
+    vector< BndBox > box_vec( m_SurfVec.size() );
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-        for ( int j = i + 1 ; j < ( int )m_SurfVec.size() ; j++ )
+    {
+        box_vec[i] = m_SurfVec[i]->GetBBox();
+    }
+
+    BndBoxTree box_tree;
+    box_tree.Build( box_vec );
+
+    vector< pair< int, int > > overlap_vec;
+    box_tree.FindOverlapPairs( overlap_vec );
+
+    //==== Co-Planar Border Checks Modify Surfs So Keep Them Serial and In Pair Order ====//
+    vector< pair< int, int > > isect_vec;
+    for ( int k = 0 ; k < ( int )overlap_vec.size() ; k++ )
+    {
+        if ( m_SurfVec[ overlap_vec[k].first ]->IntersectCheck( m_SurfVec[ overlap_vec[k].second ] ) )
         {
-            m_SurfVec[i]->Intersect( m_SurfVec[j] );
+            isect_vec.push_back( overlap_vec[k] );
         }
+    }
+
+    //==== Quad Tree Intersection - Each Surf Pair Buffers Its Own Segments ===//
+    vector< vector< PatchISeg > > pair_iseg_vec( isect_vec.size() );
+
+    #pragma omp parallel for schedule( dynamic ) num_threads( GetNumThreads() )
+    for ( int k = 0 ; k < ( int )isect_vec.size() ; k++ )
+    {
+        m_SurfVec[ isect_vec[k].first ]->IntersectPatches( m_SurfVec[ isect_vec[k].second ], pair_iseg_vec[k] );
+    }
+
+    //==== Load Segments In Pair Order So Chains Match Serial Intersection ====//
+    for ( int k = 0 ; k < ( int )pair_iseg_vec.size() ; k++ )
+    {
+        for ( int i = 0 ; i < ( int )pair_iseg_vec[k].size() ; i++ )
+        {
+            AddIntersectionSeg( pair_iseg_vec[k][i] );
+        }
+    }
 
 
     BuildChains();
@@ -2714,41 +2938,38 @@ void CfdMeshMgrSingleton::InitMesh( )
 
 void CfdMeshMgrSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3d & ip0, vec3d & ip1 )
 {
-    double d = dist_squared( ip0, ip1 );
-    if ( d < DBL_EPSILON )
+    vector< PatchISeg > iseg_vec;
+    add_patch_iseg( pA, pB, ip0, ip1, iseg_vec );
+
+    for ( int i = 0 ; i < ( int )iseg_vec.size() ; i++ )
     {
-        return;
+        AddIntersectionSeg( iseg_vec[i] );
     }
+}
 
-    vec2d proj_uwA0;
-    pA.find_closest_uw( ip0, proj_uwA0.v );
-    Puw* puwA0 = new Puw( pA.get_surf_ptr(), proj_uwA0 );
+void CfdMeshMgrSingleton::AddIntersectionSeg( const PatchISeg & iseg )
+{
+    Puw* puwA0 = new Puw( iseg.m_SurfA, iseg.m_UWA[0] );
     m_DelPuwVec.push_back( puwA0 );
 
-    vec2d proj_uwB0;
-    pB.find_closest_uw( ip0, proj_uwB0.v );
-    Puw* puwB0 = new Puw( pB.get_surf_ptr(), proj_uwB0 );
+    Puw* puwB0 = new Puw( iseg.m_SurfB, iseg.m_UWB[0] );
     m_DelPuwVec.push_back( puwB0 );
 
     IPnt* ipnt0 = new IPnt( puwA0, puwB0 );
-    ipnt0->m_Pnt = ip0;
+    ipnt0->m_Pnt = iseg.m_Pnt[0];
     m_DelIPntVec.push_back( ipnt0 );
 
-    vec2d proj_uwA1;
-    pA.find_closest_uw( ip1, proj_uwA1.v );
-    Puw* puwA1 = new Puw( pA.get_surf_ptr(), proj_uwA1 );
+    Puw* puwA1 = new Puw( iseg.m_SurfA, iseg.m_UWA[1] );
     m_DelPuwVec.push_back( puwA1 );
 
-    vec2d proj_uwB1;
-    pB.find_closest_uw( ip1, proj_uwB1.v );
-    Puw* puwB1 = new Puw( pB.get_surf_ptr(), proj_uwB1 );
+    Puw* puwB1 = new Puw( iseg.m_SurfB, iseg.m_UWB[1] );
     m_DelPuwVec.push_back( puwB1 );
 
     IPnt* ipnt1 = new IPnt( puwA1, puwB1 );
-    ipnt1->m_Pnt = ip1;
+    ipnt1->m_Pnt = iseg.m_Pnt[1];
     m_DelIPntVec.push_back( ipnt1 );
 
-    new ISeg( pA.get_surf_ptr(), pB.get_surf_ptr(), ipnt0, ipnt1 );
+    new ISeg( iseg.m_SurfA, iseg.m_SurfB, ipnt0, ipnt1 );
 
     int id0 = IPntBin::ComputeID( ipnt0->m_Pnt );
     m_BinMap[id0].m_ID = id0;
@@ -2769,11 +2990,11 @@ void CfdMeshMgrSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3
         onetime = false;
     }
 
-    double dA0 = dist( ip0, puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
-    double dB0 = dist( ip0, puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
+    double dA0 = dist( iseg.m_Pnt[0], puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
+    double dB0 = dist( iseg.m_Pnt[0], puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
 
-    double dA1 = dist( ip1, puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
-    double dB1 = dist( ip1, puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
+    double dA1 = dist( iseg.m_Pnt[1], puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
+    double dB1 = dist( iseg.m_Pnt[1], puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
 
     double tol = 1.0e-8;
     double total_d = dA0 + dB0 + dA1 + dB1;
@@ -3064,11 +3285,11 @@ void CfdMeshMgrSingleton::LoadBorderCurves()
             Surf* SurfA = m_ICurveVec[i]->m_SCurve_A->GetSurf();
             if ( !SurfA->GetSymPlaneFlag() )
             {
-                m_ICurveVec[i]->PlaneBorderTesselate( m_ICurveVec[i]->m_SCurve_A, m_ICurveVec[i]->m_SCurve_B );
+                m_ICurveVec[i]->PlaneBorderTesselate( m_ICurveVec[i]->m_SCurve_A, m_ICurveVec[i]->m_SCurve_B, GetNumThreads() );
             }
             else
             {
-                m_ICurveVec[i]->PlaneBorderTesselate( m_ICurveVec[i]->m_SCurve_B, m_ICurveVec[i]->m_SCurve_A );
+                m_ICurveVec[i]->PlaneBorderTesselate( m_ICurveVec[i]->m_SCurve_B, m_ICurveVec[i]->m_SCurve_A, GetNumThreads() );
             }
         }
         else
@@ -3940,29 +4161,36 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     double x_dist = 1.0 + big_box.GetMax( 0 ) - big_box.GetMin( 0 );
 
     //==== Count Number of Component Crossings for Each Component =====//
-    list< Tri* >::iterator t;
+    MeshList< Tri >::const_iterator t;
     for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s ) // every surface
     {
         int tri_comp_id = m_SurfVec[s]->GetCompID();
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
-        for ( t = triList.begin() ; t != triList.end(); ++t ) // every triangle
+        const MeshList< Tri > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
+
+        //==== Rays Only Read Surfs and Only Write Their Own Tri - Cast In Parallel ====//
+        vector< Tri* > tri_vec( triList.begin(), triList.end() );
+        int ntri = ( int )tri_vec.size();
+
+        #pragma omp parallel for schedule( dynamic, 64 ) num_threads( GetNumThreads() )
+        for ( int it = 0 ; it < ntri ; ++it ) // every triangle
         {
+            Tri* tri = tri_vec[it];
             vector< vector< double > > t_vec_vec;
 
             if (GetCfdSettingsPtr()->GetSymSplittingOnFlag())
             {
                 t_vec_vec.resize( m_NumComps + 10 );  // + 10 to handle possibility of outer domain and symmetry plane.
-                ( *t )->insideSurf.resize(m_NumComps + 10);
-                ( *t )->insideCount.resize(m_NumComps + 10);
+                tri->insideSurf.resize(m_NumComps + 10);
+                tri->insideCount.resize(m_NumComps + 10);
             }
             else
             {
                 t_vec_vec.resize( m_NumComps + 6 );
-                ( *t )->insideSurf.resize(m_NumComps + 6);
-                ( *t )->insideCount.resize(m_NumComps + 6);
+                tri->insideSurf.resize(m_NumComps + 6);
+                tri->insideCount.resize(m_NumComps + 6);
             }
 
-            vec3d cp = ( *t )->ComputeCenterPnt( m_SurfVec[s] );
+            vec3d cp = tri->ComputeCenterPnt( m_SurfVec[s] );
             vec3d ep = cp + vec3d( x_dist, 1.0e-4, 1.0e-4 );
 
             for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
@@ -3993,7 +4221,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
                 {
                     if ( ( int )( t_vec_vec[c].size() + 1 ) % 2 == 1 ) // +1 Reverse action on sym plane wrt outer boundary.
                     {
-                        ( *t )->insideSurf[c] = true;
+                        tri->insideSurf[c] = true;
                     }
                 }
                 else
@@ -4001,7 +4229,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
 
                     if ( ( int )t_vec_vec[c].size() % 2 == 1)
                     {
-                        ( *t )->insideSurf[c] = true;
+                        tri->insideSurf[c] = true;
                     }
                 }
             }
@@ -4037,7 +4265,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     //==== Check Vote and Mark Interior Tris =====//
     for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s )
     {
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+        const MeshList< Tri > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
         for ( t = triList.begin() ; t != triList.end(); t++ )
         {
             for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
@@ -4065,7 +4293,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     for ( int a = 0 ; a < ( int )m_SurfVec.size() ; a++ )
     {
         int tri_comp_id = m_SurfVec[a]->GetCompID();
-        list< Tri * > triList = m_SurfVec[a]->GetMesh()->GetTriList();
+        const MeshList< Tri > & triList = m_SurfVec[a]->GetMesh()->GetTriList();
         for ( t = triList.begin(); t != triList.end(); ++t )
         {
             // Determine if the triangle should be deleted
@@ -4080,7 +4308,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
         {
             if ( m_SurfVec[s]->GetSymPlaneFlag() == false )
             {
-                list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+                const MeshList< Tri > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
                 for ( t = triList.begin() ; t != triList.end(); t++ )
                 {
                     vec3d cp = ( *t )->ComputeCenterPnt( m_SurfVec[s] );
@@ -4095,7 +4323,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
             {
                 if ( m_SurfVec[s]->GetSymPlaneFlag() == true )
                 {
-                    list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+                    const MeshList< Tri > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
                     for ( t = triList.begin() ; t != triList.end(); t++ )
                     {
                         ( *t )->deleteFlag = true;
@@ -4116,12 +4344,12 @@ void CfdMeshMgrSingleton::ConnectBorderEdges( bool wakeOnly )
 {
     list< Edge* >::iterator e;
     list< Edge* > edgeList;
-    list< Tri* >::iterator t;
+    MeshList< Tri >::const_iterator t;
     for ( int s = 0 ; s < ( int )m_SurfVec.size() ; s++ )
     {
         if ( m_SurfVec[s]->GetWakeFlag() == wakeOnly )
         {
-            list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+            const MeshList< Tri > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
             for ( t = triList.begin() ; t != triList.end(); t++ )
             {
                 if ( ( *t )->e0->OtherTri( ( *t ) ) == NULL )
@@ -4591,7 +4819,7 @@ void CfdMeshMgrSingleton::LoadDrawObjs( vector< DrawObj* > &draw_obj_vec )
 
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        vector< vec3d > pVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+        vector< vec3d >& pVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
         for ( int t = 0 ; t < ( int )m_SurfVec[i]->GetMesh()->GetSimpTriVec().size() ; t++ )
         {
             if ( ( !m_SurfVec[i]->GetWakeFlag() || GetCfdSettingsPtr()->m_DrawWakeFlag.Get() ) &&
@@ -4729,7 +4957,7 @@ void CfdMeshMgr::Draw()
         for ( int i = 0 ; i < (int)m_SurfVec.size() ; i++ )
         {
 
-            vector< vec3d > pVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+            vector< vec3d >& pVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t < (int)m_SurfVec[i]->GetMesh()->GetSimpTriVec().size() ; t++ )
             {
                 if ( !m_SurfVec[i]->GetWakeFlag() &&
@@ -4755,7 +4983,7 @@ void CfdMeshMgr::Draw()
             else
                 glColor4ub( 0, 100, 0, 255 );
 
-            vector< vec3d > pVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+            vector< vec3d >& pVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t < (int)m_SurfVec[i]->GetMesh()->GetSimpTriVec().size() ; t++ )
             {
                 if ( ( !m_SurfVec[i]->GetWakeFlag() || m_DrawWakeFlag ) &&
@@ -21,8 +21,10 @@
 //              Match SCurves to create ICurves.  Create wakes surfs.
 //
 //  Intersect: Intersect all surfaces.  Intersect Y Slice Plane.
-//      Surf::Intersect - subdivide in to patchs, keep splitting till planer, intersect.
-//          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments.
+//      BndBoxTree::FindOverlapPairs - Only surface pairs with overlapping bounding boxes are intersected.
+//      Surf::IntersectPatches - subdivide in to patchs, keep splitting till planer, intersect.
+//          Surf pairs are intersected in parallel, each buffering its own segments.
+//          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments (in pair order).
 //
 //      CfdMeshMgr::LoadBorderCurves: Tesselate border curves, build border chains.
 //
@@ -46,6 +48,7 @@
 //              Remove intierior triangles.
 //
 //      CfdMeshMgr::Remesh: Remesh (split, collapse, swap, smooth) each surface mesh triangle.
+//              Surfaces are remeshed concurrently; each surface mesh is only touched by one thread.
 //
 
 
@@ -70,6 +73,8 @@
 #include "Vec3d.h"
 #include "DrawObj.h"
 #include "XferSurf.h"
+#include "PntHash.h"
+#include "MeshProfile.h"
 
 #include <assert.h>
 
@@ -160,6 +165,18 @@ protected:
 
 };
 
+//////////////////////////////////////////////////////////////////////
+//==== Final Tris Of One Surf - Reused While Its Remesh Inputs Are Unchanged ====//
+class CachedSurfMesh
+{
+public:
+
+    vector< vec3d > m_PntVec;
+    vector< vec2d > m_UWPntVec;
+    vector< SimpTri > m_TriVec;
+    int m_NumRevRemoved;
+};
+
 //////////////////////////////////////////////////////////////////////
 class CfdMeshMgrSingleton : public ParmContainer
 {
@@ -184,6 +201,23 @@ public:
 
     virtual void GenerateMesh();
 
+    //==== Stage Timing Of The Last Mesh - Also Published As Results ====//
+    const MeshProfile & GetProfile() const
+    {
+        return m_Profile;
+    }
+    //==== Chrome Trace Of Each Mesh Is Written Here - Empty For None ====//
+    virtual void SetTraceFileName( const string & file_name )
+    {
+        m_TraceFileName = file_name;
+    }
+
+    //==== Next GenerateMesh Remeshes Every Surf ====//
+    virtual void ClearMeshCache()
+    {
+        m_MeshCache.clear();
+    }
+
     virtual void addOutputText( const string &str, int output_type = CFD_OUTPUT );
 
     virtual void GUI_Val( string name, double val );
@@ -250,9 +284,8 @@ public:
 
     virtual void ExportFiles();
     //virtual void CheckDupOrAdd( Node* node, vector< Node* > & nodeVec );
-    virtual int BuildIndMap( vector< vec3d* > & allPntVec, map< int, vector< int > >& indMap, vector< int > & pntShift );
-    virtual int  FindPntIndex( vec3d& pnt, vector< vec3d* > & allPntVec,
-                               map< int, vector< int > >& indMap );
+    virtual int BuildIndMap( vector< vec3d* > & allPntVec, PntHash& indMap, vector< int > & pntShift );
+    virtual int  FindPntIndex( vec3d& pnt, PntHash& indMap );
 
     virtual string CheckWaterTight();
     virtual Edge* FindAddEdge( map< int, vector<Edge*> > & edgeMap, vector< Node* > & nodeVec, int ind1, int ind2 );
@@ -264,6 +297,13 @@ public:
     enum { NO_OUTPUT, CFD_OUTPUT, FEA_OUTPUT, };
     virtual void Remesh( int output_type );
     virtual void RemeshSingleComp( int comp_id, int output_type );
+    virtual int RemeshSurfs( const vector< bool > & remesh_flags, bool rem_rev_flag, bool use_cache, int output_type );
+
+    virtual int GetNumThreads();
+
+    virtual void StartProfileStage( const string & name );
+    virtual void EndProfileStage();
+    virtual void FinishProfile( const string & res_name, int output_type );
 
     virtual void Intersect();
     virtual void InitMesh();
@@ -273,6 +313,7 @@ public:
 
 //  virtual void AddISeg( Surf* sA, Surf* sB, vec2d & sAuw0, vec2d & sAuw1,  vec2d & sBuw0, vec2d & sBuw1 );
     virtual void AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3d & ip0, vec3d & ip1 );
+    virtual void AddIntersectionSeg( const PatchISeg & iseg );
 //  virtual ISeg* CreateSurfaceSeg( Surf* sPtr, vec3d & p0, vec3d & p1, vec2d & uw0, vec2d & uw1 );
     virtual ISeg* CreateSurfaceSeg( Surf* surfA, vec2d & uwA0, vec2d & uwA1, Surf* surfB, vec2d & uwB0, vec2d & uwB1  );
 
@@ -400,6 +441,21 @@ protected:
 
     vector< vector< vec3d > > debugRayIsect;
 
+    MeshProfile m_Profile;
+    string m_TraceFileName;
+
+    //==== Split/Collapse Work In The Last RemeshSurfs ====//
+    int m_NumRemeshEdgeVisits;
+    int m_NumRemeshSplits;
+    int m_NumRemeshCollapses;
+    size_t m_RemeshPeakMemory;
+
+    //==== Per Surf, 1 If The Last RemeshSurfs Took Its Tris From m_MeshCache ====//
+    vector< int > m_SurfReusedVec;
+
+    //==== Surf Meshes From The Last Remesh Keyed By Surf::ComputeMeshHash ====//
+    map< unsigned long long, CachedSurfMesh > m_MeshCache;
+
 
     //==== Vector of Surfs that may have a border that lies on Surf A ====//
     map< Surf*, vector< Surf* > > m_PossCoPlanarSurfMap;
@@ -709,6 +709,10 @@ void FeaMeshMgrSingleton::Build()
         return;
     }
 
+    m_Profile.Clear();
+    m_SurfReusedVec.clear();
+    StartProfileStage( "AddStructureParts" );
+
     BuildClean();
 
     if ( !m_BatchFlag )
@@ -716,20 +720,26 @@ void FeaMeshMgrSingleton::Build()
         addOutputText( "Add Structure Parts\n", FEA_OUTPUT );
     }
     AddStructureParts();
+    EndProfileStage();
 
+    StartProfileStage( "BuildGrid" );
     GetGridDensityPtr()->ClearSources();
     if ( !m_BatchFlag )
     {
         addOutputText( "Build Slice Planes\n", FEA_OUTPUT );
     }
     BuildGrid();
+    EndProfileStage();
 
+    StartProfileStage( "Intersect" );
     if ( !m_BatchFlag )
     {
         addOutputText( "Intersect\n", FEA_OUTPUT );
     }
     Intersect();
+    EndProfileStage();
 
+    StartProfileStage( "BuildTargetMap" );
     if ( !m_BatchFlag )
     {
         addOutputText( "Build Target Map\n", FEA_OUTPUT );
@@ -744,12 +754,17 @@ void FeaMeshMgrSingleton::Build()
     }
 
     RemoveSliceSurfaces();
+    EndProfileStage();
 
+    StartProfileStage( "InitMesh" );
     if ( !m_BatchFlag )
     {
         addOutputText( "InitMesh\n", FEA_OUTPUT );
     }
     InitMesh( );
+    EndProfileStage();
+
+    StartProfileStage( "Remesh" );
     if ( !m_BatchFlag )
     {
         addOutputText( "Mesh Skins\n", FEA_OUTPUT );
@@ -763,7 +778,9 @@ void FeaMeshMgrSingleton::Build()
     {
         Remesh( CfdMeshMgrSingleton::NO_OUTPUT );
     }
+    EndProfileStage();
 
+    StartProfileStage( "BuildSliceMesh" );
     if ( !m_BatchFlag )
     {
         addOutputText( "Build Spar/Rib Mesh\n", FEA_OUTPUT );
@@ -771,6 +788,9 @@ void FeaMeshMgrSingleton::Build()
     BuildSliceMesh();
 
     LoadAttachPoints();
+    EndProfileStage();
+
+    FinishProfile( "FEAMesh_Profile", m_BatchFlag ? CfdMeshMgrSingleton::NO_OUTPUT : CfdMeshMgrSingleton::FEA_OUTPUT );
 
     if ( !m_BatchFlag )
     {
@@ -781,6 +801,9 @@ void FeaMeshMgrSingleton::Build()
 
 void FeaMeshMgrSingleton::Export()
 {
+    //==== Appended To The Stages Of The Last Build ====//
+    StartProfileStage( "ExportFiles" );
+
     if ( !m_BatchFlag )
     {
         addOutputText( "Write Results\n", FEA_OUTPUT );
@@ -789,6 +812,7 @@ void FeaMeshMgrSingleton::Export()
     WriteNASTRAN( m_ExportFeaFileNames[NASTRAN_FILE_NAME] );
     WriteCalculix();
     WriteSTL( m_ExportFeaFileNames[STL_FEA_NAME] );
+    EndProfileStage();
 
     if ( !m_BatchFlag )
     {
@@ -803,6 +827,8 @@ void FeaMeshMgrSingleton::Export()
     {
         addOutputText( "Wrote Mass: feamass.dat\n", FEA_OUTPUT );
     }
+    FinishProfile( "FEAMesh_Profile", m_BatchFlag ? CfdMeshMgrSingleton::NO_OUTPUT : CfdMeshMgrSingleton::FEA_OUTPUT );
+
     char str[256];
     sprintf( str, "Total Mass = %f\n", m_TotalMass );
     if ( !m_BatchFlag )
@@ -1587,16 +1613,31 @@ void FeaMeshMgrSingleton::ComputeWriteMass()
     }
 }
 
-FeaNode* FeaMeshMgrSingleton::FindNode(  vector< FeaNode* > nodeVec, int id )
+void FeaMeshMgrSingleton::IndexNodes( const vector< FeaNode* > & nodeVec, vector< FeaNode* > & nodeIndexVec )
 {
-    //==== jrg Brute Force for Now ====//
+    int max_id = 0;
     for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
     {
-        if ( nodeVec[i]->m_Index == id )
+        max_id = max( max_id, nodeVec[i]->m_Index );
+    }
+
+    nodeIndexVec.assign( max_id + 1, NULL );
+    for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+    {
+        int id = nodeVec[i]->m_Index;
+        if ( id >= 0 && !nodeIndexVec[id] )
         {
-            return nodeVec[i];
+            nodeIndexVec[id] = nodeVec[i];
         }
     }
+}
+
+FeaNode* FeaMeshMgrSingleton::FindNode( const vector< FeaNode* > & nodeIndexVec, int id )
+{
+    if ( id >= 0 && id < ( int )nodeIndexVec.size() )
+    {
+        return nodeIndexVec[id];
+    }
 
     return NULL;
 }
@@ -1625,7 +1666,7 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
     }
 
     //==== Build Node Map ====//
-    map< int, vector< int > > indMap;
+    PntHash indMap;
     vector< int > pntShift;
     int numPnts = CfdMeshMgr.BuildIndMap( allPntVec, indMap, pntShift );
 
@@ -1633,16 +1674,21 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
     for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
     {
         nodeVec[i]->m_Tags.clear();
-        int ind = CfdMeshMgr.FindPntIndex( nodeVec[i]->m_Pnt, allPntVec, indMap );
+        int ind = CfdMeshMgr.FindPntIndex( nodeVec[i]->m_Pnt, indMap );
         nodeVec[i]->m_Index = pntShift[ind] + 1;
     }
 
+    vector< FeaNode* > nodeIndexVec;
+    IndexNodes( nodeVec, nodeIndexVec );
+
     //Stringc fn( base_filename );
     //fn.concatenate( "NASTRAN.dat" );
 
     FILE* fp = fopen( filename.c_str(), "w" );
     if ( fp )
     {
+        setvbuf( fp, NULL, _IOFBF, FEA_WRITE_BUFFER_SIZE );
+
         //===== Write Ribs ====//
         int elem_id = 0;
         int rib_cnt = 0;
@@ -1663,8 +1709,8 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 //==== Tag Rib Upper/Lower Nodes ====//
                 for ( int i = 0 ; i < ( int )rib->m_UpperPnts.size() ; i++ )
                 {
-                    int ind = CfdMeshMgr.FindPntIndex( rib->m_UpperPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    int ind = CfdMeshMgr.FindPntIndex( rib->m_UpperPnts[i], indMap );
+                    FeaNode* node = FindNode( nodeIndexVec, pntShift[ind] + 1 );
                     if ( node )
                     {
                         node->AddTag( RIB_UPPER, rib_cnt );
@@ -1672,8 +1718,8 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 }
                 for ( int i = 0 ; i < ( int )rib->m_LowerPnts.size() ; i++ )
                 {
-                    int ind = CfdMeshMgr.FindPntIndex( rib->m_LowerPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    int ind = CfdMeshMgr.FindPntIndex( rib->m_LowerPnts[i], indMap );
+                    FeaNode* node = FindNode( nodeIndexVec, pntShift[ind] + 1 );
                     if ( node )
                     {
                         node->AddTag( RIB_LOWER, rib_cnt );
@@ -1700,8 +1746,8 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 //==== Tag Spar Upper/Lower Nodes ====//
                 for ( int i = 0 ; i < ( int )spar->m_UpperPnts.size() ; i++ )
                 {
-                    int ind = CfdMeshMgr.FindPntIndex( spar->m_UpperPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    int ind = CfdMeshMgr.FindPntIndex( spar->m_UpperPnts[i], indMap );
+                    FeaNode* node = FindNode( nodeIndexVec, pntShift[ind] + 1 );
                     if ( node )
                     {
                         node->AddTag( SPAR_UPPER, spar_cnt );
@@ -1709,8 +1755,8 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 }
                 for ( int i = 0 ; i < ( int )spar->m_LowerPnts.size() ; i++ )
                 {
-                    int ind = CfdMeshMgr.FindPntIndex( spar->m_LowerPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    int ind = CfdMeshMgr.FindPntIndex( spar->m_LowerPnts[i], indMap );
+                    FeaNode* node = FindNode( nodeIndexVec, pntShift[ind] + 1 );
                     if ( node )
                     {
                         node->AddTag( SPAR_LOWER, spar_cnt );
@@ -1745,6 +1791,16 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         fprintf( fp, "\n" );
         fprintf( fp, "$Gridpoints\n\n" );
 
+        //==== Only Rib/Spar Nodes Carry Tags - Scan Those Below ====//
+        vector< FeaNode* > tagNodeVec;
+        for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+        {
+            if ( nodeVec[i]->m_Tags.size() > 0 )
+            {
+                tagNodeVec.push_back( nodeVec[i] );
+            }
+        }
+
         //==== Write Rib Spar Intersections =====//
         for ( int r = 0 ; r < rib_cnt ; r++ )
         {
@@ -1752,17 +1808,17 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
             {
                 FeaNode* upperINode = NULL;
                 FeaNode* lowerINode = NULL;
-                for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+                for ( int i = 0 ; i < ( int )tagNodeVec.size() ; i++ )
                 {
-                    if ( nodeVec[i]->m_Tags.size() > 1 )
+                    if ( tagNodeVec[i]->m_Tags.size() > 1 )
                     {
-                        if ( nodeVec[i]->HasTag( RIB_UPPER, r + 1 ) && nodeVec[i]->HasTag( SPAR_UPPER, s + 1 ) )
+                        if ( tagNodeVec[i]->HasTag( RIB_UPPER, r + 1 ) && tagNodeVec[i]->HasTag( SPAR_UPPER, s + 1 ) )
                         {
-                            upperINode = nodeVec[i];
+                            upperINode = tagNodeVec[i];
                         }
-                        if ( nodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && nodeVec[i]->HasTag( SPAR_LOWER, s + 1 ) )
+                        if ( tagNodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && tagNodeVec[i]->HasTag( SPAR_LOWER, s + 1 ) )
                         {
-                            lowerINode = nodeVec[i];
+                            lowerINode = tagNodeVec[i];
                         }
                     }
                 }
@@ -1779,13 +1835,13 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         for ( int r = 0 ; r < rib_cnt ; r++ )
         {
             vector< FeaNode* > letenodes;
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            for ( int i = 0 ; i < ( int )tagNodeVec.size() ; i++ )
             {
-                if ( nodeVec[i]->m_Tags.size() == 2 )
+                if ( tagNodeVec[i]->m_Tags.size() == 2 )
                 {
-                    if ( nodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && nodeVec[i]->HasTag( RIB_UPPER, r + 1 ) )
+                    if ( tagNodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && tagNodeVec[i]->HasTag( RIB_UPPER, r + 1 ) )
                     {
-                        letenodes.push_back( nodeVec[i] );
+                        letenodes.push_back( tagNodeVec[i] );
                     }
                 }
             }
@@ -1812,11 +1868,11 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$RibUpperBoundary,%d\n", r + 1 );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            for ( int i = 0 ; i < ( int )tagNodeVec.size() ; i++ )
             {
-                if ( nodeVec[i]->HasTag( RIB_UPPER, r + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
+                if ( tagNodeVec[i]->HasTag( RIB_UPPER, r + 1 ) && tagNodeVec[i]->m_Tags.size() == 1 )
                 {
-                    nodeVec[i]->WriteNASTRAN( fp );
+                    tagNodeVec[i]->WriteNASTRAN( fp );
                 }
             }
         }
@@ -1825,11 +1881,11 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$SparUpperBoundary,%d\n", s + 1 );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            for ( int i = 0 ; i < ( int )tagNodeVec.size() ; i++ )
             {
-                if ( nodeVec[i]->HasTag( SPAR_UPPER, s + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
+                if ( tagNodeVec[i]->HasTag( SPAR_UPPER, s + 1 ) && tagNodeVec[i]->m_Tags.size() == 1 )
                 {
-                    nodeVec[i]->WriteNASTRAN( fp );
+                    tagNodeVec[i]->WriteNASTRAN( fp );
                 }
             }
         }
@@ -1838,11 +1894,11 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$RibLowerBoundary,%d\n", r + 1 );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            for ( int i = 0 ; i < ( int )tagNodeVec.size() ; i++ )
             {
-                if ( nodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
+                if ( tagNodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && tagNodeVec[i]->m_Tags.size() == 1 )
                 {
-                    nodeVec[i]->WriteNASTRAN( fp );
+                    tagNodeVec[i]->WriteNASTRAN( fp );
                 }
             }
         }
@@ -1851,11 +1907,11 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$SparLowerBoundary,%d\n", s + 1 );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            for ( int i = 0 ; i < ( int )tagNodeVec.size() ; i++ )
             {
-                if ( nodeVec[i]->HasTag( SPAR_LOWER, s + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
+                if ( tagNodeVec[i]->HasTag( SPAR_LOWER, s + 1 ) && tagNodeVec[i]->m_Tags.size() == 1 )
                 {
-                    nodeVec[i]->WriteNASTRAN( fp );
+                    tagNodeVec[i]->WriteNASTRAN( fp );
                 }
             }
         }
@@ -1887,7 +1943,7 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
             node.WriteNASTRAN( fp );
 
             //==== Find Attach Point Index ====//
-            int ind = CfdMeshMgr.FindPntIndex( m_PointMassVec[p]->m_AttachPos, allPntVec, indMap );
+            int ind = CfdMeshMgr.FindPntIndex( m_PointMassVec[p]->m_AttachPos, indMap );
             fprintf( fp, "$Connects,%d\n", pntShift[ind] + 1 );
         }
 
@@ -1937,7 +1993,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
     }
 
     //==== Build Node Map ====//
-    map< int, vector< int > > indMap;
+    PntHash indMap;
     vector< int > pntShift;
     CfdMeshMgr.BuildIndMap( allPntVec, indMap, pntShift );
 
@@ -1945,7 +2001,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
     for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
     {
         nodeVec[i]->m_Tags.clear();
-        int ind = CfdMeshMgr.FindPntIndex( nodeVec[i]->m_Pnt, allPntVec, indMap );
+        int ind = CfdMeshMgr.FindPntIndex( nodeVec[i]->m_Pnt, indMap );
         nodeVec[i]->m_Index = pntShift[ind] + 1;
     }
 
@@ -1962,7 +2018,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             m_WingSections[s].m_UpperSkin.LoadNodes( nVec );
             for ( int i = 0 ; i < ( int )nVec.size() ; i++ )
             {
-                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, allPntVec, indMap );
+                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, indMap );
                 nodeVec[ind]->AddTag( SKIN_UPPER, s );
             }
             upperSkins.push_back( &m_WingSections[s].m_UpperSkin );
@@ -1973,7 +2029,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             m_WingSections[s].m_LowerSkin.LoadNodes( nVec );
             for ( int i = 0 ; i < ( int )nVec.size() ; i++ )
             {
-                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, allPntVec, indMap );
+                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, indMap );
                 nodeVec[ind]->AddTag( SKIN_LOWER, s );
             }
             lowerSkins.push_back( &m_WingSections[s].m_LowerSkin );
@@ -1986,7 +2042,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             m_WingSections[s].m_RibVec[r]->LoadNodes( nVec );
             for ( int i = 0 ; i < ( int )nVec.size() ; i++ )
             {
-                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, allPntVec, indMap );
+                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, indMap );
                 nodeVec[ind]->AddTag( RIB_ALL, r );
             }
             ribs.push_back( m_WingSections[s].m_RibVec[r] );
@@ -1998,7 +2054,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             m_WingSections[s].m_SparVec[r]->LoadNodes( nVec );
             for ( int i = 0 ; i < ( int )nVec.size() ; i++ )
             {
-                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, allPntVec, indMap );
+                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, indMap );
                 nodeVec[ind]->AddTag( SPAR_ALL, r );
             }
             spars.push_back( m_WingSections[s].m_SparVec[r] );
@@ -2020,6 +2076,8 @@ void FeaMeshMgrSingleton::WriteCalculix( )
     FILE* fp = fopen( fn.c_str(), "w" );
     if ( fp )
     {
+        setvbuf( fp, NULL, _IOFBF, FEA_WRITE_BUFFER_SIZE );
+
         int elem_id = 1;
 
         //==== Upper Skin Nodes ====//
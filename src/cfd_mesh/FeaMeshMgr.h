@@ -168,7 +168,9 @@ public:
     virtual FeaSkin* GetCurrLowerSkin();
     virtual FeaPointMass* GetCurrPointMass();
 
-    virtual FeaNode* FindNode( vector< FeaNode* > nodeVec, int id );
+    //==== Index Nodes By m_Index - First Node With Each Index Wins ====//
+    virtual void IndexNodes( const vector< FeaNode* > & nodeVec, vector< FeaNode* > & nodeIndexVec );
+    virtual FeaNode* FindNode( const vector< FeaNode* > & nodeIndexVec, int id );
 
     virtual void AddRib();
     virtual void DelCurrRib();
@@ -227,6 +229,7 @@ public:
     virtual void MouseClick( vec2d & cursor );
 
     enum { MASS_FILE_NAME, NASTRAN_FILE_NAME, GEOM_FILE_NAME, THICK_FILE_NAME, STL_FEA_NAME, NUM_FEA_FILE_NAMES };
+    enum { FEA_WRITE_BUFFER_SIZE = 1 << 20 };       // Bytes
     string GetFeaExportFileName( int type );
     void SetFeaExportFileName( const string &fn, int type );
     bool GetFeaExportFileFlag( int type );
@@ -1684,8 +1684,8 @@ void FeaSkin::BuildMesh()
     //}
     //
 
-    vector < vec3d >pvec = m_Surf->GetMesh()->GetSimpPntVec();
-    vector < SimpTri > tvec = m_Surf->GetMesh()->GetSimpTriVec();
+    vector < vec3d >& pvec = m_Surf->GetMesh()->GetSimpPntVec();
+    vector < SimpTri >& tvec = m_Surf->GetMesh()->GetSimpTriVec();
     for ( int i = 0 ; i < ( int )tvec.size() ; i++ )
     {
         FeaTri* tri = new FeaTri;
@@ -63,10 +63,10 @@ void ICurve::BorderTesselate( )
     m_SCurve_B->BorderTesselate( );
 }
 
-void ICurve::PlaneBorderTesselate( SCurve* crv_A, SCurve* crv_B )
+void ICurve::PlaneBorderTesselate( SCurve* crv_A, SCurve* crv_B, int num_threads )
 {
     crv_A->CheapTesselate();
-    crv_B->ProjectTessToSurf( crv_A );
+    crv_B->ProjectTessToSurf( crv_A, num_threads );
 }
 
 void ICurve::Draw()
@@ -41,7 +41,7 @@ public:
 
     bool Match( SCurve* crv_A, SCurve* crv_B );
     void BorderTesselate( );
-    void PlaneBorderTesselate( SCurve* sca, SCurve* scb );
+    void PlaneBorderTesselate( SCurve* sca, SCurve* scb, int num_threads );
     void SetACurve( SCurve* crv_A )
     {
         m_SCurve_A = crv_A;
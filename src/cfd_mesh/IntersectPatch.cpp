@@ -9,11 +9,9 @@
 
 #include "IntersectPatch.h"
 #include "Surf.h"
-#include "CfdMeshMgr.h"
-// #include "FeaMeshMgr.h"
 #include "Tritri.h"
 
-void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
+void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth, vector< PatchISeg > & iseg_vec )
 {
     int MAX_SUB = 3;
     if ( !Compare( *bp1.get_bbox(), *bp2.get_bbox() ) )
@@ -32,7 +30,7 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
 
     if ( bp1.GetSubDepth() > MAX_SUB && bp2.GetSubDepth() > MAX_SUB )
     {
-        intersect_quads( bp1, bp2 );          // Plane - Plane Intersection
+        intersect_quads( bp1, bp2, iseg_vec );          // Plane - Plane Intersection
     }
     else
     {
@@ -44,10 +42,10 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
                 bps1[i].SetSubDepth( bp1.GetSubDepth() + 1 );
             }
 
-            intersect( bps1[0], bp2, depth );
-            intersect( bps1[1], bp2, depth );
-            intersect( bps1[2], bp2, depth );
-            intersect( bps1[3], bp2, depth );
+            intersect( bps1[0], bp2, depth, iseg_vec );
+            intersect( bps1[1], bp2, depth, iseg_vec );
+            intersect( bps1[2], bp2, depth, iseg_vec );
+            intersect( bps1[3], bp2, depth, iseg_vec );
         }
         else
         {
@@ -57,15 +55,15 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
                 bps2[i].SetSubDepth( bp2.GetSubDepth() + 1 );
             }
 
-            intersect( bp1, bps2[0], depth );
-            intersect( bp1, bps2[1], depth );
-            intersect( bp1, bps2[2], depth );
-            intersect( bp1, bps2[3], depth );
+            intersect( bp1, bps2[0], depth, iseg_vec );
+            intersect( bp1, bps2[1], depth, iseg_vec );
+            intersect( bp1, bps2[2], depth, iseg_vec );
+            intersect( bp1, bps2[3], depth, iseg_vec );
         }
     }
 }
 
-void intersect_quads( SurfPatch& pa, SurfPatch& pb )
+void intersect_quads( SurfPatch& pa, SurfPatch& pb, vector< PatchISeg > & iseg_vec )
 {
     int iflag;
     int coplanar;
@@ -84,28 +82,51 @@ void intersect_quads( SurfPatch& pa, SurfPatch& pb )
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_patch_iseg( pa, pb, ip0, ip1, iseg_vec );
     }
 
     //==== Tri A1 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_patch_iseg( pa, pb, ip0, ip1, iseg_vec );
     }
 
     //==== Tri A2 and B1 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb,  ip0, ip1 );
+        add_patch_iseg( pa, pb, ip0, ip1, iseg_vec );
     }
 
     //==== Tri A2 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_patch_iseg( pa, pb, ip0, ip1, iseg_vec );
     }
 }
 
+//===== Project Intersection Points To Both Patches - Safe To Call From Multiple Threads =====//
+void add_patch_iseg( SurfPatch& pa, SurfPatch& pb, vec3d & ip0, vec3d & ip1, vector< PatchISeg > & iseg_vec )
+{
+    double d = dist_squared( ip0, ip1 );
+    if ( d < DBL_EPSILON )
+    {
+        return;
+    }
+
+    PatchISeg iseg;
+    iseg.m_SurfA = pa.get_surf_ptr();
+    iseg.m_SurfB = pb.get_surf_ptr();
+    iseg.m_Pnt[0] = ip0;
+    iseg.m_Pnt[1] = ip1;
+
+    for ( int i = 0 ; i < 2 ; i++ )
+    {
+        pa.find_closest_uw( iseg.m_Pnt[i], iseg.m_UWA[i].v );
+        pb.find_closest_uw( iseg.m_Pnt[i], iseg.m_UWB[i].v );
+    }
+
+    iseg_vec.push_back( iseg );
+}
@@ -25,8 +25,19 @@
 using namespace std;
 
 
+//===== Intersection Segment Between Two Patches - Buffered Until Loaded Into Mesh Mgr =====//
+struct PatchISeg
+{
+    Surf* m_SurfA;
+    Surf* m_SurfB;
+    vec3d m_Pnt[2];
+    vec2d m_UWA[2];
+    vec2d m_UWB[2];
+};
+
 //===== Intersect Two Bezier Patches  =====//
-void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth );
-void intersect_quads( SurfPatch& pa, SurfPatch& pb );
+void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth, vector< PatchISeg > & iseg_vec );
+void intersect_quads( SurfPatch& pa, SurfPatch& pb, vector< PatchISeg > & iseg_vec );
+void add_patch_iseg( SurfPatch& pa, SurfPatch& pb, vec3d & ip0, vec3d & ip1, vector< PatchISeg > & iseg_vec );
 
 #endif
@@ -12,6 +12,9 @@
 #include "triangle.h"
 #include "CfdMeshMgr.h"
 #include "Util.h"
+#include "ContentHash.h"
+
+#include <queue>
 
 
 bool LongEdgePairLengthCompare( const pair< Edge*, double >& a, const pair< Edge*, double >& b )
@@ -36,41 +39,59 @@ Mesh::Mesh()
 
     m_Surf = NULL;
     m_GridDensity = NULL;
+
+    m_PeakMemorySize = 0;
+
+    ClearRemeshCounts();
 }
 
 Mesh::~Mesh()
 {
-    DumpGarbage();
     Clear();
 }
 
 void Mesh::Clear()
 {
-    list< Tri* >::iterator t;
-    for ( t = triList.begin() ; t != triList.end(); t++ )
+    //==== Garbage Lives In The Pools Too ====//
+    DumpGarbage();
+
+    //==== Links Live In The Elements - Unlink Before Destroying ====//
+    while ( !triList.empty() )
     {
-        delete ( *t );
+        Tri* t = triList.front();
+        triList.erase( t );
+        m_TriPool.Destroy( t );
     }
 
-    triList.clear();
-
-    list< Edge* >::iterator e;
-    for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
+    while ( !edgeList.empty() )
     {
-        delete ( *e );
+        Edge* e = edgeList.front();
+        edgeList.erase( e );
+        m_EdgePool.Destroy( e );
     }
 
-    edgeList.clear();
-
-    list< Node* >::iterator n;
-    for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
+    while ( !nodeList.empty() )
     {
-        delete ( *n );
+        Node* n = nodeList.front();
+        nodeList.erase( n );
+        m_NodePool.Destroy( n );
     }
 
-    nodeList.clear();
+    m_PeakMemorySize = GetPeakMemorySize();
 
+    m_TriPool.Release();
+    m_EdgePool.Release();
+    m_NodePool.Release();
+}
 
+size_t Mesh::GetMemorySize() const
+{
+    return m_TriPool.GetMemorySize() + m_EdgePool.GetMemorySize() + m_NodePool.GetMemorySize();
+}
+
+size_t Mesh::GetPeakMemorySize() const
+{
+    return max( m_PeakMemorySize, GetMemorySize() );
 }
 
 void Mesh::LimitTargetEdgeLength( Node* n )
@@ -144,7 +165,7 @@ void Mesh::LimitTargetEdgeLength( Edge* e )
 void Mesh::LimitTargetEdgeLength()
 {
     Node *n;
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     vector< Edge* >::iterator ne;
     double growratio = m_GridDensity->m_GrowRatio();
     double limitlen;
@@ -182,13 +203,13 @@ void Mesh::LimitTargetEdgeLength()
 }
 
 
-void Mesh::Remesh()
+void Mesh::Remesh( int mode )
 {
     int num_split = 1;
     int num_collapse = 1;
 
     //==== Find Target Edge Lengths ====//
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         ( *e )->ComputeLength();
@@ -197,15 +218,22 @@ void Mesh::Remesh()
 
     LimitTargetEdgeLength();
 
-    for ( int i = 0 ; i < 20 ; i++ )
+    if ( mode == REMESH_QUEUE )
     {
-        if ( num_split )
-        {
-            num_split = Split( 1 );
-        }
-        if ( num_collapse )
+        QueueSplitCollapse();
+    }
+    else
+    {
+        for ( int i = 0 ; i < 20 ; i++ )
         {
-            num_collapse = Collapse( 1 );
+            if ( num_split )
+            {
+                num_split = Split( 1 );
+            }
+            if ( num_collapse )
+            {
+                num_collapse = Collapse( 1 );
+            }
         }
     }
 
@@ -225,7 +253,7 @@ void Mesh::Remesh()
 
 void Mesh::LoadSimpTris()
 {
-    list< Tri* >::iterator t;
+    MeshList< Tri >::iterator t;
     simpTriVec.resize( triList.size() );
     simpPntVec.resize( triList.size() * 3 );
     simpUWPntVec.resize( triList.size() * 3 );
@@ -285,6 +313,51 @@ void Mesh::CondenseSimpTris()
     }
 }
 
+void Mesh::AddToHash( ContentHash & hash ) const
+{
+    if ( m_GridDensity )
+    {
+        hash.Add( m_GridDensity->m_GrowRatio() );
+        hash.Add( m_GridDensity->m_MinLen() );
+    }
+
+    map< Node*, int > node_ind_map;
+    MeshList< Node >::const_iterator n;
+    for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
+    {
+        int ind = ( int )node_ind_map.size();
+        node_ind_map[ *n ] = ind;
+
+        hash.Add( ( *n )->pnt );
+        hash.Add( ( *n )->uw );
+        hash.Add( ( int )( *n )->fixed );
+    }
+
+    map< Edge*, int > edge_ind_map;
+    MeshList< Edge >::const_iterator e;
+    for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
+    {
+        int ind = ( int )edge_ind_map.size();
+        edge_ind_map[ *e ] = ind;
+
+        hash.Add( node_ind_map[ ( *e )->n0 ] );
+        hash.Add( node_ind_map[ ( *e )->n1 ] );
+        hash.Add( ( int )( *e )->border );
+        hash.Add( ( int )( *e )->ridge );
+    }
+
+    MeshList< Tri >::const_iterator t;
+    for ( t = triList.begin() ; t != triList.end(); t++ )
+    {
+        hash.Add( node_ind_map[ ( *t )->n0 ] );
+        hash.Add( node_ind_map[ ( *t )->n1 ] );
+        hash.Add( node_ind_map[ ( *t )->n2 ] );
+        hash.Add( edge_ind_map[ ( *t )->e0 ] );
+        hash.Add( edge_ind_map[ ( *t )->e1 ] );
+        hash.Add( edge_ind_map[ ( *t )->e2 ] );
+    }
+}
+
 void Mesh::StretchSimpPnts( double start_x, double end_x, double scale, double angle )
 {
     double factor = scale - 1.0;
@@ -339,12 +412,13 @@ int Mesh::CheckDupOrAdd( int ind, map< int, vector< int > > & indMap, vector< ve
 int Mesh::Split( int num_iter )
 {
     int num_long_edges = 0;
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( int iter = 0 ; iter < num_iter ; iter++ )
     {
         //===== Split ====//
         vector < pair < Edge*, double > > longEdges;
         longEdges.reserve( edgeList.size() );
+        m_NumEdgeVisits += ( int )edgeList.size();
         for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
         {
             if ( !( *e )->border )
@@ -388,11 +462,12 @@ int Mesh::Collapse( int num_iter )
     int num_short_edges = 0;
     for ( int iter = 0 ; iter < num_iter ; iter++ )
     {
-        list< Edge* >::iterator e;
+        MeshList< Edge >::iterator e;
 
         //==== Collapse =====//
         vector < pair < Edge*, double > > shortEdges;
         shortEdges.reserve( edgeList.size() );
+        m_NumEdgeVisits += ( int )edgeList.size();
         for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
         {
             if ( ValidCollapse( *e ) )
@@ -436,13 +511,169 @@ int Mesh::Collapse( int num_iter )
 
 }
 
+void Mesh::QueueSplitCollapse()
+{
+    //==== Worst Ratio First - Ties In Queue Order So Results Do Not Depend On Addresses ====//
+    vector< Edge* > queue_edge_vec;
+    priority_queue< pair< double, int > > edge_queue;
+
+    MeshList< Edge >::iterator e;
+    for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
+    {
+        queue_edge_vec.push_back( *e );
+    }
+
+    int max_visits = 20 * ( int )queue_edge_vec.size();
+    int num_visits = 0;
+
+    int nqueue = 0;
+    while ( true )
+    {
+        //==== Queue Out Of Range Edges Added Since Last Pass ====//
+        for ( ; nqueue < ( int )queue_edge_vec.size() ; nqueue++ )
+        {
+            Edge* edge = queue_edge_vec[nqueue];
+            if ( edge->m_DeleteMeFlag || edge->border )
+            {
+                continue;
+            }
+
+            m_NumEdgeVisits++;
+            double rat = edge->GetLength() / edge->target_len;
+            if ( rat > 1.41 )
+            {
+                edge_queue.push( pair< double, int >( rat, -nqueue ) );
+            }
+            else if ( rat < 0.707 )
+            {
+                edge_queue.push( pair< double, int >( 1.0 / rat, -nqueue ) );
+            }
+        }
+
+        if ( edge_queue.empty() || num_visits >= max_visits )
+        {
+            break;
+        }
+
+        Edge* edge = queue_edge_vec[ -edge_queue.top().second ];
+        edge_queue.pop();
+
+        //==== Deleted Edges Stay In Garbage Until The Queue Is Done ====//
+        if ( edge->m_DeleteMeFlag )
+        {
+            continue;
+        }
+        num_visits++;
+        m_NumEdgeVisits++;
+
+        edge->ComputeLength();
+        double rat = edge->GetLength() / edge->target_len;
+
+        Node* nnew = NULL;
+        if ( rat > 1.41 )
+        {
+            nnew = SplitEdge( edge );
+        }
+        else if ( rat < 0.707 && ValidCollapse( edge ) && CollapseStaysShort( edge ) )
+        {
+            nnew = CollapseEdge( edge );
+        }
+
+        //==== Only Edges At The New Node Changed Length Or Target ====//
+        if ( nnew )
+        {
+            for ( int i = 0 ; i < ( int )nnew->edgeVec.size() ; i++ )
+            {
+                nnew->edgeVec[i]->ComputeLength();
+                queue_edge_vec.push_back( nnew->edgeVec[i] );
+            }
+        }
+    }
+
+    DumpGarbage();
+}
+
+//==== Halves Of A Split Edge Are Just Short Enough To Collapse, Which Brings ====//
+//==== Back The Long Edge - Without This Check The Queue Splits and         ====//
+//==== Collapses The Same Edges Until It Runs Out Of Visits                 ====//
+bool Mesh::CollapseStaysShort( Edge* edge )
+{
+    Node* n0 = edge->n0;
+    Node* n1 = edge->n1;
+
+    vec3d pc;
+    vec2d uwc;
+    if ( n0->fixed )
+    {
+        pc = n0->pnt;
+        uwc = n0->uw;
+    }
+    else if ( n1->fixed )
+    {
+        pc = n1->pnt;
+        uwc = n1->uw;
+    }
+    else
+    {
+        uwc = ( n0->uw + n1->uw ) * 0.5;
+        pc  = m_Surf->CompPnt( uwc.x(), uwc.y() );
+    }
+
+    //==== Targets Are Recomputed At The Moved Edge Centers Then Limited By ====//
+    //==== Growth From Neighbors, As In CollapseEdge                         ====//
+    double growratio = m_GridDensity->m_GrowRatio();
+    Node* nvec[2] = { n0, n1 };
+
+    double limitlen = 1.0e12;
+    for ( int n = 0 ; n < 2 ; n++ )
+    {
+        for ( int i = 0 ; i < ( int )nvec[n]->edgeVec.size() ; i++ )
+        {
+            limitlen = min( limitlen, growratio * nvec[n]->edgeVec[i]->target_len );
+        }
+    }
+
+    for ( int n = 0 ; n < 2 ; n++ )
+    {
+        for ( int i = 0 ; i < ( int )nvec[n]->edgeVec.size() ; i++ )
+        {
+            Edge* e = nvec[n]->edgeVec[i];
+            if ( e == edge || e->border )
+            {
+                continue;
+            }
+            Node* other = e->OtherNode( nvec[n] );
+            vec2d uwcent = ( uwc + other->uw ) * 0.5;
+
+            double target_len = min( m_Surf->InterpTargetMap( uwcent.x(), uwcent.y() ), limitlen );
+            for ( int j = 0 ; j < ( int )other->edgeVec.size() ; j++ )
+            {
+                target_len = min( target_len, growratio * other->edgeVec[j]->target_len );
+            }
+
+            if ( dist( pc, other->pnt ) > 1.41 * target_len )
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void Mesh::ClearRemeshCounts()
+{
+    m_NumEdgeVisits = 0;
+    m_NumSplits = 0;
+    m_NumCollapses = 0;
+}
+
 int Mesh::RemoveRevTris()
 {
     int badcount = 0;
 
     vector < Edge* > remEdges;
 
-    list< Tri* >::iterator t;
+    MeshList< Tri >::iterator t;
     for ( t = triList.begin() ; t != triList.end(); t++ )
     {
         vec3d ntri = (*t)->Normal();
@@ -485,7 +716,7 @@ int Mesh::RemoveRevTris()
 
 void Mesh::ColorTris()
 {
-    list< Tri* >::iterator t;
+    MeshList< Tri >::iterator t;
     for ( t = triList.begin() ; t != triList.end(); t++ )
     {
         double q = ( *t )->ComputeQual();
@@ -511,23 +742,22 @@ void Mesh::ColorTris()
 
 Node* Mesh::AddNode( vec3d p, vec2d uw_in )
 {
-    Node* nptr = new Node( p, uw_in );
+    Node* nptr = m_NodePool.Create( p, uw_in );
     nodeList.push_back( nptr );
-    nptr->list_ptr = --nodeList.end();
     return nptr;
 }
 
 void Mesh::RemoveNode( Node* nptr )
 {
     garbageNodeVec.push_back( nptr );
-    nodeList.erase( nptr->list_ptr );
+    nodeList.erase( nptr );
 
     nptr->m_DeleteMeFlag = true;
 }
 
 Node* Mesh::FindNode( const vec3d& p )
 {
-    list< Node* >::iterator n;
+    MeshList< Node >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
     {
         if ( !( *n )->m_DeleteMeFlag && dist_squared( ( *n )->pnt, p ) < 1.0e-7 )
@@ -540,10 +770,9 @@ Node* Mesh::FindNode( const vec3d& p )
 
 Edge* Mesh::AddEdge( Node* n0, Node* n1 )
 {
-    Edge* eptr = new Edge( n0, n1 );
+    Edge* eptr = m_EdgePool.Create( n0, n1 );
 
     edgeList.push_back( eptr );
-    eptr->list_ptr = --edgeList.end();
 
     n0->AddConnectEdge( eptr );
     n1->AddConnectEdge( eptr );
@@ -559,14 +788,14 @@ void Mesh::RemoveEdge( Edge* eptr )
     eptr->n1->RemoveConnectEdge( eptr );
 
     garbageEdgeVec.push_back( eptr );
-    edgeList.erase( eptr->list_ptr );
+    edgeList.erase( eptr );
 
     eptr->m_DeleteMeFlag = true;
 }
 
 Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 {
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( !( *e )->m_DeleteMeFlag )
@@ -586,16 +815,15 @@ Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 
 Tri* Mesh::AddTri( Node* n0, Node* n1, Node* n2, Edge* e0, Edge* e1, Edge* e2 )
 {
-    Tri* tptr = new Tri( n0, n1, n2, e0, e1, e2 );
+    Tri* tptr = m_TriPool.Create( n0, n1, n2, e0, e1, e2 );
     triList.push_back( tptr );
-    tptr->list_ptr = --triList.end();
     return tptr;
 }
 
 void Mesh::RemoveTri( Tri* tptr )
 {
     garbageTriVec.push_back( tptr );
-    triList.erase( tptr->list_ptr );
+    triList.erase( tptr );
     tptr->m_DeleteMeFlag = true;
 }
 
@@ -604,34 +832,34 @@ void Mesh::DumpGarbage()
     //==== Delete Flagged Nodes =====//
     for ( int i = 0 ; i < ( int )garbageNodeVec.size() ; i++ )
     {
-        delete garbageNodeVec[i];
+        m_NodePool.Destroy( garbageNodeVec[i] );
     }
     garbageNodeVec.clear();
 
     //==== Delete Flagged Edges =====//
     for ( int i = 0 ; i < ( int )garbageEdgeVec.size() ; i++ )
     {
-        delete garbageEdgeVec[i];
+        m_EdgePool.Destroy( garbageEdgeVec[i] );
     }
     garbageEdgeVec.clear();
 
     //==== Delete Flagged Tris =====//
     for ( int i = 0 ; i < ( int )garbageTriVec.size() ; i++ )
     {
-        delete garbageTriVec[i];
+        m_TriPool.Destroy( garbageTriVec[i] );
     }
     garbageTriVec.clear();
 }
 
 void Mesh::SetNodeFlags()
 {
-    list< Node* >::iterator n;
+    MeshList< Node >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
     {
         ( *n )->fixed = false;
     }
 
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( ( *e )->border || ( *e )->ridge )
@@ -642,13 +870,13 @@ void Mesh::SetNodeFlags()
     }
 }
 
-void Mesh::SplitEdge( Edge* edge )
+Node* Mesh::SplitEdge( Edge* edge )
 {
     assert( m_Surf );
 
     if ( edge->border )                     // Dont Split Borders
     {
-        return;
+        return NULL;
     }
 
     assert( edge->t0 || edge->t1 );
@@ -783,6 +1011,9 @@ void Mesh::SplitEdge( Edge* edge )
 
     ComputeTargetEdgeLength( ns );
     LimitTargetEdgeLength( ns );
+
+    m_NumSplits++;
+    return ns;
 }
 
 void Mesh::SwapEdge( Edge* edge )
@@ -1058,7 +1289,7 @@ void Mesh::CollapseHighlightEdge()
 {
     Edge* hedge = NULL;
     int cnt = 0;
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( cnt == m_HighlightEdgeIndex )
@@ -1077,7 +1308,7 @@ void Mesh::CollapseHighlightEdge()
 
 }
 
-void Mesh::CollapseEdge( Edge* edge )
+Node* Mesh::CollapseEdge( Edge* edge )
 {
     Node* n0 = edge->n0;
     Node* n1 = edge->n1;
@@ -1137,11 +1368,11 @@ void Mesh::CollapseEdge( Edge* edge )
 
     if ( !ValidNodeMove( n0, pc, ta ) )
     {
-        return;
+        return NULL;
     }
     if ( !ValidNodeMove( n1, pc, tb ) )
     {
-        return;
+        return NULL;
     }
 
     Node* nc  = AddNode( pc, uwc );
@@ -1256,13 +1487,15 @@ void Mesh::CollapseEdge( Edge* edge )
 
 //CheckValidAllEdges( );
 
+    m_NumCollapses++;
+    return nc;
 }
 
 void Mesh::LaplacianSmooth( int num_iter )
 {
     for ( int i = 0 ; i < num_iter ; i++ )
     {
-        list< Node* >::iterator n;
+        MeshList< Node >::iterator n;
         for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
         {
             if ( !( *n )->m_DeleteMeFlag && !( *n )->fixed )
@@ -1284,7 +1517,7 @@ void Mesh::OptSmooth( int num_iter )
 {
     for ( int i = 0 ; i < num_iter ; i++ )
     {
-        list< Node* >::iterator n;
+        MeshList< Node >::iterator n;
         for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
         {
             if ( !( *n )->m_DeleteMeFlag && !( *n )->fixed )
@@ -1300,7 +1533,7 @@ void Mesh::AdjustEdgeLengths()
 {
     //==== Find Avg Edge Length ====//
     double avg_length = 0.0;
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         avg_length += dist( ( *e )->n0->pnt, ( *e )->n1->pnt );
@@ -1351,7 +1584,7 @@ void Mesh::ComputeTargetEdgeLength( Edge* edge )
 
 void Mesh::CheckValidAllEdges()
 {
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( !( *e )->m_DeleteMeFlag )
@@ -1749,7 +1982,7 @@ void Mesh::InitMesh( vector< vec2d > & uw_points, vector< MeshSeg > & segs_index
     }
 
     //==== Fix The Exterior Edges ====//
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( ( *e )->t0 == NULL || ( *e )->t1 == NULL )
@@ -1818,7 +2051,7 @@ void Mesh::RemoveInteriorTrisEdgesNodes()
     set < Edge* > remEdges;
     set < Node* > remNodes;
 
-    list< Tri* >::iterator t;
+    MeshList< Tri >::iterator t;
     for ( t = triList.begin() ; t != triList.end(); t++ )
     {
         //==== Check Surrounding Tris =====//
@@ -2017,7 +2250,7 @@ void Mesh::ReadSTL( const char* file_name )
     fclose( file_id );
 
     //==== Fix The Exterior Edges ====//
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( ( *e )->t0 == NULL || ( *e )->t1 == NULL )
@@ -2078,7 +2311,7 @@ void Mesh::Draw()
 {
 
     //==== Debug ====//
-    //list< Tri* >::iterator t;
+    //MeshList< Tri >::iterator t;
     //for ( t = triList.begin() ; t != triList.end(); t++ )
     //{
     //  glColor3ubv( (*t)->rgb );
@@ -2097,7 +2330,7 @@ void Mesh::Draw()
 
     Edge* hl_edge = NULL;
     int edge_cnt = 0;
-    list< Edge* >::iterator e;
+    MeshList< Edge >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         glLineWidth( 1.0 );
@@ -2131,7 +2364,7 @@ void Mesh::Draw()
     //glPointSize( 3.0f );
     //glBegin( GL_POINTS );
     //int cnt = 0;
-    //list< Node* >::iterator n;
+    //MeshList< Node >::iterator n;
     //for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
     //{
     //  glColor3ub( 255, 0, 0 );
@@ -14,9 +14,11 @@
 #include "Vec2d.h"
 #include "Vec3d.h"
 #include "Tri.h"
+#include "MeshPool.h"
 
 class Surf;
 class GridDensity;
+class ContentHash;
 
 #ifndef WIN32
 #  ifndef NDEBUG
@@ -54,21 +56,44 @@ public:
 
     void Draw();
 
-    void Remesh();
+    enum { REMESH_SWEEP, REMESH_QUEUE };
+
+    void Remesh( int mode = REMESH_SWEEP );
     void LoadSimpTris();
     void CondenseSimpTris();
     int CheckDupOrAdd( int ind, map< int, vector< int > > & indMap, vector< vec3d > & pntVec );
 
 
     int Split( int num_iter );
-    void SplitEdge( Edge* edge );
+    Node* SplitEdge( Edge* edge );
 
     bool ThreeEdgesThreeTris( Edge* edge );
     void SwapEdge( Edge* edge );
 
     int Collapse( int num_iter );
     bool ValidCollapse( Edge* edge );
-    void CollapseEdge( Edge* edge );
+    Node* CollapseEdge( Edge* edge );
+
+    //==== Collapse Would Not Leave An Edge Long Enough To Split ====//
+    bool CollapseStaysShort( Edge* edge );
+
+    //==== Split and Collapse Out Of Range Edges Worst First, Requeue Changed Edges ====//
+    void QueueSplitCollapse();
+
+    //==== Remesh Work Counts - Not Reset By Clear ====//
+    void ClearRemeshCounts();
+    int GetNumEdgeVisits() const
+    {
+        return m_NumEdgeVisits;
+    }
+    int GetNumSplits() const
+    {
+        return m_NumSplits;
+    }
+    int GetNumCollapses() const
+    {
+        return m_NumCollapses;
+    }
 
     int RemoveRevTris();
 
@@ -138,10 +163,23 @@ public:
 
     void ColorTris();
 
-    list <Tri*> GetTriList()
+    //==== Live Elements - Returned By Reference, Valid Until The Mesh Changes ====//
+    const MeshList< Tri > & GetTriList() const
     {
         return triList;
     }
+    const MeshList< Edge > & GetEdgeList() const
+    {
+        return edgeList;
+    }
+    const MeshList< Node > & GetNodeList() const
+    {
+        return nodeList;
+    }
+    int GetNumTris() const
+    {
+        return ( int )triList.size();
+    }
 
     vector < vec3d >& GetSimpPntVec()
     {
@@ -158,21 +196,38 @@ public:
 
     void StretchSimpPnts( double start_x, double end_x, double factor, double angle );
 
+    //==== Everything Remesh Reads From The Mesh Itself ====//
+    void AddToHash( ContentHash & hash ) const;
+
     void RemoveInteriorTrisEdgesNodes();
 
+    //==== Bytes Reserved For Nodes, Edges and Tris ====//
+    size_t GetMemorySize() const;
+    size_t GetPeakMemorySize() const;
+
 protected:
 
     Surf* m_Surf;
     GridDensity* m_GridDensity;
 
-    list < Tri* > triList;
-    list < Edge* > edgeList;
-    list < Node* > nodeList;
+    MeshList< Tri > triList;
+    MeshList< Edge > edgeList;
+    MeshList< Node > nodeList;
 
     vector< Tri* > garbageTriVec;
     vector< Edge* > garbageEdgeVec;
     vector< Node* > garbageNodeVec;
 
+    MeshPool< Tri > m_TriPool;
+    MeshPool< Edge > m_EdgePool;
+    MeshPool< Node > m_NodePool;
+
+    size_t m_PeakMemorySize;
+
+    int m_NumEdgeVisits;
+    int m_NumSplits;
+    int m_NumCollapses;
+
     int m_HighlightNodeIndex;
     int m_HighlightEdgeIndex;
 
@@ -0,0 +1,194 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// MeshList.h: Intrusive doubly linked list of mesh nodes, edges and tris.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(MESH_MESHLIST__INCLUDED_)
+#define MESH_MESHLIST__INCLUDED_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+using namespace std;
+
+template < class T > class MeshList;
+
+//////////////////////////////////////////////////////////////////////
+//==== Prev/Next Links Live In The Element So Linking Never Allocates ====//
+template < class T >
+class MeshListLink
+{
+public:
+
+    MeshListLink()
+    {
+        m_ListPrev = m_ListNext = NULL;
+    }
+
+protected:
+
+    friend class MeshList< T >;
+
+    T* m_ListPrev;
+    T* m_ListNext;
+};
+
+//////////////////////////////////////////////////////////////////////
+//==== Same Iteration Order and Usage As list< T* >.  An Element Can Be In At Most One MeshList. ====//
+template < class T >
+class MeshList
+{
+public:
+
+    class const_iterator
+    {
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef T* value_type;
+        typedef ptrdiff_t difference_type;
+        typedef T* const * pointer;
+        typedef T* const & reference;
+
+        const_iterator( T* ptr = NULL )
+        {
+            m_Ptr = ptr;
+        }
+
+        reference operator*() const
+        {
+            return m_Ptr;
+        }
+        const_iterator & operator++()
+        {
+            m_Ptr = m_Ptr->m_ListNext;
+            return *this;
+        }
+        const_iterator operator++( int )
+        {
+            const_iterator prev = *this;
+            m_Ptr = m_Ptr->m_ListNext;
+            return prev;
+        }
+        bool operator==( const const_iterator & rhs ) const
+        {
+            return m_Ptr == rhs.m_Ptr;
+        }
+        bool operator!=( const const_iterator & rhs ) const
+        {
+            return m_Ptr != rhs.m_Ptr;
+        }
+
+    protected:
+        T* m_Ptr;
+    };
+    typedef const_iterator iterator;
+
+    MeshList()
+    {
+        m_Head = m_Tail = NULL;
+        m_Size = 0;
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator( m_Head );
+    }
+    const_iterator end() const
+    {
+        return const_iterator();
+    }
+    T* front() const
+    {
+        return m_Head;
+    }
+    T* back() const
+    {
+        return m_Tail;
+    }
+    size_t size() const
+    {
+        return m_Size;
+    }
+    bool empty() const
+    {
+        return m_Size == 0;
+    }
+
+    void push_back( T* ptr )
+    {
+        ptr->m_ListPrev = m_Tail;
+        ptr->m_ListNext = NULL;
+        if ( m_Tail )
+        {
+            m_Tail->m_ListNext = ptr;
+        }
+        else
+        {
+            m_Head = ptr;
+        }
+        m_Tail = ptr;
+        m_Size++;
+    }
+
+    //==== Unlink - Iterators At ptr Are Invalid Afterwards, Others Are Untouched ====//
+    void erase( T* ptr )
+    {
+        if ( ptr->m_ListPrev )
+        {
+            ptr->m_ListPrev->m_ListNext = ptr->m_ListNext;
+        }
+        else
+        {
+            m_Head = ptr->m_ListNext;
+        }
+        if ( ptr->m_ListNext )
+        {
+            ptr->m_ListNext->m_ListPrev = ptr->m_ListPrev;
+        }
+        else
+        {
+            m_Tail = ptr->m_ListPrev;
+        }
+        ptr->m_ListPrev = ptr->m_ListNext = NULL;
+        m_Size--;
+    }
+
+    //==== Forget All Elements Without Touching Them ====//
+    void clear()
+    {
+        m_Head = m_Tail = NULL;
+        m_Size = 0;
+    }
+
+    //==== Stable Like list::sort ====//
+    template < class Compare >
+    void sort( Compare comp )
+    {
+        vector< T* > vec( begin(), end() );
+        stable_sort( vec.begin(), vec.end(), comp );
+
+        clear();
+        for ( int i = 0 ; i < ( int )vec.size() ; i++ )
+        {
+            push_back( vec[i] );
+        }
+    }
+
+protected:
+
+    //==== Links Are In The Elements - Copying Would Corrupt Them ====//
+    MeshList( const MeshList & );
+    MeshList & operator=( const MeshList & );
+
+    T* m_Head;
+    T* m_Tail;
+    size_t m_Size;
+
+};
+
+#endif
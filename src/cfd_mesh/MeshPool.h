@@ -0,0 +1,121 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// MeshPool.h: Block allocated storage for mesh nodes, edges and tris.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(MESH_MESHPOOL__INCLUDED_)
+#define MESH_MESHPOOL__INCLUDED_
+
+#include <new>
+#include <utility>
+#include <vector>
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////
+//==== Objects Are Placed Contiguously In Fixed Size Blocks.  Destroyed Slots ====//
+//==== Go On A Free List and Are Reused (Most Recent First) By Later Creates. ====//
+template < class T >
+class MeshPool
+{
+public:
+
+    MeshPool( int block_size = 512 )
+    {
+        m_BlockSize = block_size > 0 ? block_size : 1;
+        m_NumLive = m_PeakNumLive = 0;
+        m_NextInBlock = m_BlockSize;
+    }
+    virtual ~MeshPool()
+    {
+        Release();
+    }
+
+    template < class... Args >
+    T* Create( Args&&... args )
+    {
+        void* mem;
+        if ( !m_FreeVec.empty() )
+        {
+            mem = m_FreeVec.back();
+            m_FreeVec.pop_back();
+        }
+        else
+        {
+            if ( m_NextInBlock == m_BlockSize )
+            {
+                m_BlockVec.push_back( static_cast< T* >( ::operator new( m_BlockSize * sizeof( T ) ) ) );
+                m_NextInBlock = 0;
+            }
+            mem = m_BlockVec.back() + m_NextInBlock;
+            m_NextInBlock++;
+        }
+
+        m_NumLive++;
+        if ( m_NumLive > m_PeakNumLive )
+        {
+            m_PeakNumLive = m_NumLive;
+        }
+
+        return new ( mem ) T( std::forward< Args >( args )... );
+    }
+
+    void Destroy( T* ptr )
+    {
+        ptr->~T();
+        m_FreeVec.push_back( ptr );
+        m_NumLive--;
+    }
+
+    //==== Free All Blocks - All Objects Must Already Be Destroyed ====//
+    void Release()
+    {
+        for ( int i = 0 ; i < ( int )m_BlockVec.size() ; i++ )
+        {
+            ::operator delete( m_BlockVec[i] );
+        }
+        m_BlockVec.clear();
+        m_FreeVec.clear();
+        m_NextInBlock = m_BlockSize;
+        m_NumLive = 0;
+    }
+
+    int GetNumLive() const
+    {
+        return m_NumLive;
+    }
+    int GetPeakNumLive() const
+    {
+        return m_PeakNumLive;
+    }
+    void ResetPeak()
+    {
+        m_PeakNumLive = m_NumLive;
+    }
+
+    //==== Bytes Reserved By Blocks ====//
+    size_t GetMemorySize() const
+    {
+        return m_BlockVec.size() * m_BlockSize * sizeof( T );
+    }
+
+protected:
+
+    //==== Blocks Own Storage and Are Never Shared ====//
+    MeshPool( const MeshPool & );
+    MeshPool & operator=( const MeshPool & );
+
+    int m_BlockSize;
+    int m_NextInBlock;
+    int m_NumLive;
+    int m_PeakNumLive;
+
+    vector< T* > m_BlockVec;
+    vector< T* > m_FreeVec;
+
+};
+
+#endif
@@ -0,0 +1,194 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// MeshProfile.cpp: Wall time, CPU time, memory and element counts per mesh stage.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "MeshProfile.h"
+#include "ResultsMgr.h"
+
+#include <stdio.h>
+
+#ifdef WIN32
+#include <windows.h>
+#ifndef PSAPI_VERSION
+#define PSAPI_VERSION 2                             // GetProcessMemoryInfo From Kernel32
+#endif
+#include <psapi.h>
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+MeshProfile::MeshProfile()
+{
+    Clear();
+}
+
+MeshProfile::~MeshProfile()
+{
+}
+
+void MeshProfile::Clear()
+{
+    m_StartClock = chrono::steady_clock::now();
+    m_StageOpen = false;
+    m_StageCPUTime = 0.0;
+    m_StagePeakRSS = 0.0;
+    m_StageVec.clear();
+}
+
+void MeshProfile::StartStage( const string & name )
+{
+    if ( m_StageOpen )
+    {
+        EndStage( 0, 0, 0 );
+    }
+
+    MeshStage stage;
+    stage.m_Name = name;
+    stage.m_StartTime = GetElapsedTime();
+    stage.m_WallTime = stage.m_CPUTime = stage.m_PeakRSSDelta = 0.0;
+    stage.m_NumSurfs = stage.m_NumChains = stage.m_NumTris = 0;
+    m_StageVec.push_back( stage );
+
+    m_StageCPUTime = GetCPUTime();
+    m_StagePeakRSS = GetPeakRSS();
+    m_StageOpen = true;
+}
+
+void MeshProfile::EndStage( int num_surfs, int num_chains, int num_tris )
+{
+    if ( !m_StageOpen )
+    {
+        return;
+    }
+    m_StageOpen = false;
+
+    MeshStage & stage = m_StageVec.back();
+    stage.m_WallTime = GetElapsedTime() - stage.m_StartTime;
+    stage.m_CPUTime = GetCPUTime() - m_StageCPUTime;
+    stage.m_PeakRSSDelta = GetPeakRSS() - m_StagePeakRSS;
+    stage.m_NumSurfs = num_surfs;
+    stage.m_NumChains = num_chains;
+    stage.m_NumTris = num_tris;
+}
+
+string MeshProfile::CreateResults( const string & res_name ) const
+{
+    vector< string > name_vec;
+    vector< double > wall_vec, cpu_vec, rss_vec;
+    vector< int > surf_vec, chain_vec, tri_vec;
+    double total_wall = 0.0;
+    double total_cpu = 0.0;
+
+    for ( int i = 0 ; i < ( int )m_StageVec.size() ; i++ )
+    {
+        const MeshStage & stage = m_StageVec[i];
+        name_vec.push_back( stage.m_Name );
+        wall_vec.push_back( stage.m_WallTime );
+        cpu_vec.push_back( stage.m_CPUTime );
+        rss_vec.push_back( stage.m_PeakRSSDelta );
+        surf_vec.push_back( stage.m_NumSurfs );
+        chain_vec.push_back( stage.m_NumChains );
+        tri_vec.push_back( stage.m_NumTris );
+        total_wall += stage.m_WallTime;
+        total_cpu += stage.m_CPUTime;
+    }
+
+    Results* res = ResultsMgr.CreateResults( res_name );
+    res->Add( NameValData( "Stage_Name", name_vec ) );
+    res->Add( NameValData( "Wall_Time", wall_vec ) );
+    res->Add( NameValData( "CPU_Time", cpu_vec ) );
+    res->Add( NameValData( "Peak_RSS_Delta_KB", rss_vec ) );
+    res->Add( NameValData( "Num_Surfs", surf_vec ) );
+    res->Add( NameValData( "Num_Chains", chain_vec ) );
+    res->Add( NameValData( "Num_Tris", tri_vec ) );
+    res->Add( NameValData( "Total_Wall_Time", total_wall ) );
+    res->Add( NameValData( "Total_CPU_Time", total_cpu ) );
+    res->Add( NameValData( "Peak_RSS_KB", GetPeakRSS() ) );
+
+    return res->GetID();
+}
+
+bool MeshProfile::WriteChromeTrace( const string & file_name ) const
+{
+    FILE* fp = fopen( file_name.c_str(), "w" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    fprintf( fp, "{\"traceEvents\":[\n" );
+    for ( int i = 0 ; i < ( int )m_StageVec.size() ; i++ )
+    {
+        const MeshStage & stage = m_StageVec[i];
+        fprintf( fp, "{\"name\":\"%s\",\"cat\":\"mesh\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                 "\"ts\":%.0f,\"dur\":%.0f,\"args\":{\"cpu_time\":%f,\"peak_rss_delta_kb\":%.0f,"
+                 "\"num_surfs\":%d,\"num_chains\":%d,\"num_tris\":%d}}%s\n",
+                 stage.m_Name.c_str(), stage.m_StartTime * 1.0e6, stage.m_WallTime * 1.0e6,
+                 stage.m_CPUTime, stage.m_PeakRSSDelta,
+                 stage.m_NumSurfs, stage.m_NumChains, stage.m_NumTris,
+                 ( i < ( int )m_StageVec.size() - 1 ) ? "," : "" );
+    }
+    fprintf( fp, "],\"displayTimeUnit\":\"ms\"}\n" );
+
+    fclose( fp );
+    return true;
+}
+
+double MeshProfile::GetElapsedTime() const
+{
+    return chrono::duration< double >( chrono::steady_clock::now() - m_StartClock ).count();
+}
+
+double MeshProfile::GetCPUTime()
+{
+#ifdef WIN32
+    FILETIME create_time, exit_time, kernel_time, user_time;
+    if ( !GetProcessTimes( GetCurrentProcess(), &create_time, &exit_time, &kernel_time, &user_time ) )
+    {
+        return 0.0;
+    }
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel_time.dwLowDateTime;
+    k.HighPart = kernel_time.dwHighDateTime;
+    u.LowPart = user_time.dwLowDateTime;
+    u.HighPart = user_time.dwHighDateTime;
+    return ( double )( k.QuadPart + u.QuadPart ) * 1.0e-7;
+#else
+    struct rusage usage;
+    if ( getrusage( RUSAGE_SELF, &usage ) != 0 )
+    {
+        return 0.0;
+    }
+    return ( double )( usage.ru_utime.tv_sec + usage.ru_stime.tv_sec ) +
+           ( double )( usage.ru_utime.tv_usec + usage.ru_stime.tv_usec ) * 1.0e-6;
+#endif
+}
+
+double MeshProfile::GetPeakRSS()
+{
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if ( !GetProcessMemoryInfo( GetCurrentProcess(), &pmc, sizeof( pmc ) ) )
+    {
+        return 0.0;
+    }
+    return ( double )pmc.PeakWorkingSetSize / 1024.0;
+#else
+    struct rusage usage;
+    if ( getrusage( RUSAGE_SELF, &usage ) != 0 )
+    {
+        return 0.0;
+    }
+#ifdef __APPLE__
+    return ( double )usage.ru_maxrss / 1024.0;      // Bytes
+#else
+    return ( double )usage.ru_maxrss;               // KB
+#endif
+#endif
+}
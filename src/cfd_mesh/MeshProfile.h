@@ -0,0 +1,74 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// MeshProfile.h: Wall time, CPU time, memory and element counts per mesh stage.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(MESH_MESHPROFILE__INCLUDED_)
+#define MESH_MESHPROFILE__INCLUDED_
+
+#include <chrono>
+#include <string>
+#include <vector>
+using namespace std;
+
+class MeshStage
+{
+public:
+
+    string m_Name;
+    double m_StartTime;             // Seconds Since Profile Start
+    double m_WallTime;
+    double m_CPUTime;
+    double m_PeakRSSDelta;          // KB
+    int m_NumSurfs;
+    int m_NumChains;
+    int m_NumTris;
+};
+
+//////////////////////////////////////////////////////////////////////
+class MeshProfile
+{
+public:
+
+    MeshProfile();
+    virtual ~MeshProfile();
+
+    void Clear();
+
+    //==== Stages Run One After Another - Start Closes Any Open Stage ====//
+    void StartStage( const string & name );
+    void EndStage( int num_surfs, int num_chains, int num_tris );
+
+    const vector< MeshStage > & GetStageVec() const
+    {
+        return m_StageVec;
+    }
+
+    //==== Publish Stages As Results, Return Results ID ====//
+    string CreateResults( const string & res_name ) const;
+
+    //==== Chrome Trace Event Format (chrome://tracing) ====//
+    bool WriteChromeTrace( const string & file_name ) const;
+
+    static double GetCPUTime();             // Seconds Used By Process
+    static double GetPeakRSS();             // KB
+
+protected:
+
+    double GetElapsedTime() const;
+
+    chrono::steady_clock::time_point m_StartClock;
+
+    bool m_StageOpen;
+    double m_StageCPUTime;
+    double m_StagePeakRSS;
+
+    vector< MeshStage > m_StageVec;
+
+};
+
+#endif
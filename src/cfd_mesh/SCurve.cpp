@@ -157,24 +157,45 @@ void SCurve::CheapTesselate( )
     UWTess();
 }
 
-void SCurve::ProjectTessToSurf( SCurve* othercurve )
+void SCurve::ProjectTessToSurf( SCurve* othercurve, int num_threads )
 {
     vector< vec3d > UWTessB = othercurve->GetUWTessPnts();
 
     Surf* SurfA = GetSurf();
     Surf* SurfB = othercurve->GetSurf();
 
+    int npts = UWTessB.size();
+    vector< vec3d > ptOther( npts );
+    for ( int i = 0 ; i < npts ; i++ )
+    {
+        ptOther[i] = SurfB->CompPnt( UWTessB[i].x(), UWTessB[i].y() );
+    }
+
+    //==== Project All Points At Once From Tess Seeds ====//
+    vector< vec2d > uw_vec;
+    vector< double > dist_vec;
+    SurfA->ClosestUW( ptOther, uw_vec, dist_vec, num_threads );
+
+    //==== Thin Regions Can Seed The Wrong Side - Retry From Previous Point ====//
+    double tol = 1.0e-8 * SurfA->GetBBox().DiagDist();
     double uguess = SurfA->GetSurfCore()->GetMidU();
     double wguess = SurfA->GetSurfCore()->GetMidW();
 
-    int npts = UWTessB.size();
     m_UWTess.clear();
     m_UWTess.resize( npts );
     for ( int i = 0 ; i < npts ; i++ )
     {
-        vec3d ptOther = SurfB->CompPnt( UWTessB[i].x(), UWTessB[i].y() );
+        vec2d uw = uw_vec[i];
 
-        vec2d uw = SurfA->ClosestUW( ptOther, uguess, wguess );
+        if ( dist_vec[i] > tol )
+        {
+            double u, w;
+            double d = SurfA->GetSurfCore()->FindNearest( u, w, ptOther[i], uguess, wguess );
+            if ( d < dist_vec[i] )
+            {
+                uw.set_xy( u, w );
+            }
+        }
 
         m_UWTess[i] = vec3d( uw.x(), uw.y(), 0 );
 
@@ -50,7 +50,7 @@ public:
 
     void BorderTesselate( );
     void CheapTesselate( );
-    void ProjectTessToSurf( SCurve* sca );
+    void ProjectTessToSurf( SCurve* sca, int num_threads );
     void InterpDistTable( double idouble, double &t, double &u, double &s, double &dsdi );
     void BuildDistTable( GridDensity* grid_den, SCurve* BCurve, list< MapSource* > & splitSources );
     void CleanupDistTable();
@@ -15,6 +15,7 @@
 #include "CfdMeshMgr.h"
 #include "StlHelper.h"
 #include "SubSurfaceMgr.h"
+#include "ContentHash.h"
 
 Surf::Surf()
 {
@@ -124,7 +125,7 @@ double Surf::TargetLen( double u, double w, double gap, double radfrac )
     return len;
 }
 
-void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
+void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid, int num_threads )
 {
     int npatchu = m_SurfCore.GetNumUPatches();
     int npatchw = m_SurfCore.GetNumWPatches();
@@ -154,6 +155,21 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
         limitFlag = true;
     }
 
+    // Evaluate map points and query sources in one batch
+    vector< vec3d > pnt_vec( nmapu * nmapw );
+    for( int i = 0; i < nmapu ; i++ )
+    {
+        double u = umin + du * ( 1.0 * i ) / ( nmapu - 1 );
+        for( int j = 0; j < nmapw ; j++ )
+        {
+            double w = wmin + dw * ( 1.0 * j ) / ( nmapw - 1 );
+            pnt_vec[ i * nmapw + j ] = m_SurfCore.CompPnt( u, w );
+        }
+    }
+
+    vector< double > grid_len_vec;
+    m_GridDensityPtr->GetTargetLen( pnt_vec, grid_len_vec, limitFlag, num_threads );
+
     // Loop over surface evaluating source strength and curvature
     for( int i = 0; i < nmapu ; i++ )
     {
@@ -172,9 +188,8 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
             len = max( len, m_GridDensityPtr->m_MinLen() );
 
             // apply sources
-            vec3d p = m_SurfCore.CompPnt( u, w );
-            double grid_len = m_GridDensityPtr->GetTargetLen( p, limitFlag );
-            len = min( len, grid_len );
+            vec3d p = pnt_vec[ i * nmapw + j ];
+            len = min( len, grid_len_vec[ i * nmapw + j ] );
 
             // finally check max size
             len = min( len, m_GridDensityPtr->GetBaseLen( limitFlag ) );
@@ -407,6 +422,32 @@ void Surf::LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap )
     }
 }
 
+unsigned long long Surf::ComputeMeshHash( int remesh_mode, bool rem_rev_flag ) const
+{
+    ContentHash hash;
+
+    //==== Sweep and Queue Modes Give Different Tris ====//
+    hash.Add( remesh_mode );
+    hash.Add( ( int )rem_rev_flag );
+
+    m_SurfCore.AddToHash( hash );
+    hash.Add( ( int )m_FlipFlag );
+
+    hash.Add( m_NumMap );
+    for ( int i = 0 ; i < ( int )m_SrcMap.size() ; i++ )
+    {
+        hash.Add( ( int )m_SrcMap[i].size() );
+        for ( int j = 0 ; j < ( int )m_SrcMap[i].size() ; j++ )
+        {
+            hash.Add( m_SrcMap[i][j].m_str );
+        }
+    }
+
+    m_Mesh.AddToHash( hash );
+
+    return hash.Get();
+}
+
 double Surf::InterpTargetMap( double u, double w )
 {
     int i, j;
@@ -502,6 +543,13 @@ vec2d Surf::ClosestUW( vec3d & pnt_in, double guess_u, double guess_w ) const
     return vec2d( u, w );
 }
 
+//==== Batch ClosestUW - Guesses Seeded From Coarse Tess When guess_vec Is Empty ====//
+void Surf::ClosestUW( const vector< vec3d > & pnt_vec, vector< vec2d > & uw_vec, vector< double > & dist_vec, int num_threads,
+                      const vector< vec2d > & guess_vec ) const
+{
+    m_SurfCore.FindNearest( uw_vec, dist_vec, pnt_vec, guess_vec, num_threads );
+}
+
 void Surf::FindBorderCurves()
 {
     double degen_tol = 1.0e-6;
@@ -628,40 +676,62 @@ void Surf::WriteSTL( const char* filename )
 
 void Surf::Intersect( Surf* surfPtr )
 {
-    int i;
+    if ( !IntersectCheck( surfPtr ) )
+    {
+        return;
+    }
+
+    vector< PatchISeg > iseg_vec;
+    IntersectPatches( surfPtr, iseg_vec );
+
+    for ( int i = 0 ; i < ( int )iseg_vec.size() ; i++ )
+    {
+        CfdMeshMgr.AddIntersectionSeg( iseg_vec[i] );
+    }
+}
 
+//==== Check If Surfs Need Intersecting - May Add Co-Planar Border Curves, So Not Thread Safe ====//
+bool Surf::IntersectCheck( Surf* surfPtr )
+{
     if ( surfPtr->GetCompID() == m_CompID )
     {
-        return;
+        return false;
     }
 
     if ( !Compare( m_BBox, surfPtr->GetBBox() ) )
     {
-        return;
+        return false;
     }
     if ( BorderCurveOnSurface( surfPtr ) )
     {
-        return;
+        return false;
     }
     if ( surfPtr->BorderCurveOnSurface( this ) )
     {
-        return;
+        return false;
     }
 
-    vector< SurfPatch* > otherPatchVec = surfPtr->GetPatchVec();
-    for ( i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
+    return true;
+}
+
+//==== Intersect Patches - Only Reads Surf Data So Pairs Can Be Done Concurrently ====//
+void Surf::IntersectPatches( Surf* surfPtr, vector< PatchISeg > & iseg_vec )
+{
+    vector< SurfPatch* > & otherPatchVec = surfPtr->GetPatchVec();
+    for ( int i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
         if ( Compare( *m_PatchVec[i]->get_bbox(), surfPtr->GetBBox() ) )
         {
             for ( int j = 0 ; j < ( int )otherPatchVec.size() ; j++ )
             {
                 if ( Compare( *m_PatchVec[i]->get_bbox(), *otherPatchVec[j]->get_bbox() ) )
                 {
-                    intersect( *m_PatchVec[i], *otherPatchVec[j], 0 );
+                    intersect( *m_PatchVec[i], *otherPatchVec[j], 0, iseg_vec );
                 }
             }
         }
 }
 
+//==== Thread Safe - Only Reads Patches and Patch Tree ====//
 void Surf::IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals )
 {
     BndBox line_box;
@@ -673,9 +743,14 @@ void Surf::IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals )
         return;
     }
 
-    for ( int i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
+    //==== Patches Are Visited In Index Order So T Vals Match A Full Patch Loop ====//
+    vector< int > patch_ind_vec;
+    m_PatchTree.FindOverlap( line_box, patch_ind_vec );
+    std::sort( patch_ind_vec.begin(), patch_ind_vec.end() );
+
+    for ( int i = 0 ; i < ( int )patch_ind_vec.size() ; i++ )
     {
-        m_PatchVec[i]->IntersectLineSeg( p0, p1, line_box, t_vals );
+        m_PatchVec[ patch_ind_vec[i] ]->IntersectLineSeg( p0, p1, line_box, t_vals );
     }
 }
 
@@ -691,8 +766,8 @@ void Surf::IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_va
     }
 
     double tparm, uparm, vparm;
-    list< Tri* >::iterator t;
-    list <Tri*> triList = m_Mesh.GetTriList();
+    MeshList< Tri >::const_iterator t;
+    const MeshList< Tri > & triList = m_Mesh.GetTriList();
 
     vec3d dir = p1 - p0;
 
@@ -844,6 +919,18 @@ void Surf::SetBBox( const vec3d &pmin, const vec3d &pmax )
     m_BBox.Update( pmax );
 }
 
+void Surf::SetPatchVec( const vector< SurfPatch* > &pvec )
+{
+    m_PatchVec = pvec;
+
+    vector< BndBox > box_vec( m_PatchVec.size() );
+    for ( int i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
+    {
+        box_vec[i] = *m_PatchVec[i]->get_bbox();
+    }
+    m_PatchTree.Build( box_vec );
+}
+
 
 void Surf::InitMesh( vector< ISegChain* > chains )
 {
@@ -873,18 +960,22 @@ void Surf::InitMesh( vector< ISegChain* > chains )
 //}
 //fclose(fp);
 
-    //==== Store Only One Instance of each IPnt ====//
+    //==== Store Only One Instance of each IPnt - In Chain Order, Not Pointer Order, So Mesh Is Repeatable ====//
     set< IPnt* > ipntSet;
+    vector< IPnt* > ipntVec;
     for ( int i = 0 ; i < ( int )chains.size() ; i++ )
         for ( int j = 0 ; j < ( int )chains[i]->m_TessVec.size() ; j++ )
         {
-            ipntSet.insert( chains[i]->m_TessVec[j] );
+            if ( ipntSet.insert( chains[i]->m_TessVec[j] ).second )
+            {
+                ipntVec.push_back( chains[i]->m_TessVec[j] );
+            }
         }
 
     vector < vec2d > uwPntVec;
 
-    set< IPnt* >::iterator ip;
-    for ( ip = ipntSet.begin() ; ip != ipntSet.end() ; ip++ )
+    vector< IPnt* >::iterator ip;
+    for ( ip = ipntVec.begin() ; ip != ipntVec.end() ; ip++ )
     {
         vec2d uw = ( *ip )->GetPuw( this )->m_UW;
 
@@ -1299,7 +1390,7 @@ bool Surf::BorderMatch( Surf* otherSurf )
     return false;
 }
 
-void Surf::Subtag( bool tag_subs )
+void Surf::Subtag( bool tag_subs, int num_threads )
 {
     vector< SimpTri >& tri_vec = m_Mesh.GetSimpTriVec();
     vector< vec2d >& pnts = m_Mesh.GetSimpUWPntVec();
@@ -1307,21 +1398,25 @@ void Surf::Subtag( bool tag_subs )
 
     if ( tag_subs ) s_surfs = SubSurfaceMgr.GetSubSurfs( m_GeomID, m_MainSurfID );
 
-    for ( int t = 0 ; t < ( int ) tri_vec.size() ; t++ )
+    SubSurfTagGrid tag_grid;
+    tag_grid.Build( s_surfs );
+
+    //==== Tris Are Tagged Independently ====//
+    int ntri = ( int )tri_vec.size();
+    #pragma omp parallel for num_threads( num_threads )
+    for ( int t = 0 ; t < ntri ; t++ )
     {
         SimpTri& tri = tri_vec[t];
         tri.m_Tags.push_back( m_BaseTag );
         vec2d center = ( pnts[tri.ind0] + pnts[tri.ind1] + pnts[tri.ind2] ) * 1 / 3.0;
-        vec2d cent2d = center;
 
-        for ( int s = 0 ; s < ( int ) s_surfs.size() ; s++ )
-        {
-            if ( s_surfs[s]->Subtag( vec3d( cent2d.x(), cent2d.y(), 0 ) ) )
-            {
-                tri.m_Tags.push_back( s_surfs[s]->m_Tag );
-            }
-        }
-        SubSurfaceMgr.m_TagCombos.insert( tri.m_Tags );
+        tag_grid.Subtag( vec3d( center.x(), center.y(), 0 ), tri.m_Tags );
+    }
+
+    //==== Merge Tag Combos In Tri Order ====//
+    for ( int t = 0 ; t < ntri ; t++ )
+    {
+        SubSurfaceMgr.m_TagCombos.insert( tri_vec[t].m_Tags );
     }
 }
 
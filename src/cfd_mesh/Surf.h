@@ -17,8 +17,10 @@
 #include "Mesh.h"
 #include "GridDensity.h"
 #include "SurfPatch.h"
+#include "IntersectPatch.h"
 #include "MapSource.h"
 #include "SurfCore.h"
+#include "BndBoxTree.h"
 
 #include <assert.h>
 
@@ -58,7 +60,7 @@ public:
     }
 
     double TargetLen( double u, double w, double gap, double radfrac );
-    void BuildTargetMap( vector< MapSource* > &sources, int sid );
+    void BuildTargetMap( vector< MapSource* > &sources, int sid, int num_threads );
     void WalkMap( int istart, int jstart, int kstart );
     void WalkMap( int istart, int jstart );
     void LimitTargetMap();
@@ -70,6 +72,8 @@ public:
     void ApplyES( vec3d uw, double t );
 
     vec2d ClosestUW( vec3d & pnt_in, double guess_u, double guess_w ) const;
+    void ClosestUW( const vector< vec3d > & pnt_vec, vector< vec2d > & uw_vec, vector< double > & dist_vec, int num_threads,
+                    const vector< vec2d > & guess_vec = vector< vec2d >() ) const;
 
 
     void FindBorderCurves();
@@ -141,7 +145,12 @@ public:
         return &m_Mesh;
     }
 
+    //==== Hash Of All Inputs To Remesh, Including How It Is Run - Equal Hashes Give Equal Meshes ====//
+    unsigned long long ComputeMeshHash( int remesh_mode, bool rem_rev_flag ) const;
+
     void Intersect( Surf* surfPtr );
+    bool IntersectCheck( Surf* surfPtr );
+    void IntersectPatches( Surf* surfPtr, vector< PatchISeg > & iseg_vec );
     void IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals );
     void IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_vals );
 
@@ -158,10 +167,7 @@ public:
     {
         return m_PatchVec;
     }
-    void SetPatchVec( const vector< SurfPatch* > &pvec )
-    {
-        m_PatchVec = pvec;
-    }
+    void SetPatchVec( const vector< SurfPatch* > &pvec );
 
     void InitMesh( vector< ISegChain* > chains );
 
@@ -234,7 +240,7 @@ public:
         m_BaseTag = tag;
     }
 
-    void Subtag( bool tag_subs );
+    void Subtag( bool tag_subs, int num_threads );
 
 protected:
 
@@ -261,6 +267,7 @@ protected:
 
     BndBox m_BBox;
     vector< SurfPatch* > m_PatchVec;
+    BndBoxTree m_PatchTree;             // Patch Bounding Boxes - Indices Into m_PatchVec
 
     vector< SCurve* > m_SCurveVec;
 
@@ -5,6 +5,8 @@
 
 #include "SurfCore.h"
 #include "BezierCurve.h"
+#include "ContentHash.h"
+#include "PntNodeMerge.h"
 
 #include "eli/geom/surface/piecewise_body_of_revolution_creator.hpp"
 #include "eli/geom/surface/piecewise_capped_surface_creator.hpp"
@@ -575,6 +577,53 @@ bool SurfCore::MatchThisOrientation( const piecewise_surface_type &osurf ) const
     return true;
 }
 
+//==== Patch Layout, Parameter Ranges and Control Points ====//
+void SurfCore::AddToHash( ContentHash & hash ) const
+{
+    piecewise_surface_type::index_type ip, jp, nupatch, nvpatch;
+    nupatch = m_Surface.number_u_patches();
+    nvpatch = m_Surface.number_v_patches();
+
+    hash.Add( ( int )nupatch );
+    hash.Add( ( int )nvpatch );
+
+    vector< double > pmap;
+    m_Surface.get_pmap_u( pmap );
+    for ( int i = 0 ; i < ( int )pmap.size() ; i++ )
+    {
+        hash.Add( pmap[i] );
+    }
+    m_Surface.get_pmap_v( pmap );
+    for ( int i = 0 ; i < ( int )pmap.size() ; i++ )
+    {
+        hash.Add( pmap[i] );
+    }
+
+    for( ip = 0; ip < nupatch; ++ip )
+    {
+        for( jp = 0; jp < nvpatch; ++jp )
+        {
+            surface_patch_type::index_type icp, jcp;
+            const surface_patch_type *patch = m_Surface.get_patch( ip, jp );
+
+            hash.Add( ( int )patch->degree_u() );
+            hash.Add( ( int )patch->degree_v() );
+
+            for( icp = 0; icp <= patch->degree_u(); ++icp )
+            {
+                for( jcp = 0; jcp <= patch->degree_v(); ++jcp )
+                {
+                    surface_point_type cp;
+                    cp = patch->get_control_point( icp, jcp );
+                    hash.Add( cp.x() );
+                    hash.Add( cp.y() );
+                    hash.Add( cp.z() );
+                }
+            }
+        }
+    }
+}
+
 void SurfCore::WriteSurf( FILE* fp ) const
 {
     vector< vector< vec3d > > pntVec;
@@ -795,3 +844,91 @@ double SurfCore::FindNearest( double &u, double &w, const vec3d &pt, double u0,
 
     return dist;
 }
+
+void SurfCore::FindNearest( vector< vec2d > & uw_vec, vector< double > & dist_vec, const vector< vec3d > & pt_vec,
+                            const vector< vec2d > & guess_vec, int num_threads ) const
+{
+    int npt = ( int )pt_vec.size();
+    uw_vec.resize( npt );
+    dist_vec.resize( npt );
+
+    vector< vec2d > seed_vec;
+    if ( guess_vec.size() != pt_vec.size() )
+    {
+        SeedNearest( seed_vec, pt_vec, num_threads );
+    }
+    const vector< vec2d > & start_vec = seed_vec.empty() ? guess_vec : seed_vec;
+
+    //==== Points Are Independent ====//
+    #pragma omp parallel for schedule( dynamic, 64 ) num_threads( num_threads )
+    for ( int i = 0 ; i < npt ; i++ )
+    {
+        double u, w;
+        dist_vec[i] = FindNearest( u, w, pt_vec[i], start_vec[i].x(), start_vec[i].y() );
+        uw_vec[i].set_xy( u, w );
+    }
+}
+
+//==== Nearest Of nsub x nsub Samples Per Patch ====//
+void SurfCore::SeedNearest( vector< vec2d > & guess_vec, const vector< vec3d > & pt_vec, int num_threads, int nsub ) const
+{
+    int npt = ( int )pt_vec.size();
+    guess_vec.resize( npt );
+    if ( npt == 0 )
+    {
+        return;
+    }
+
+    vector< double > pmap_u, pmap_w;
+    m_Surface.get_pmap_u( pmap_u );
+    m_Surface.get_pmap_v( pmap_w );
+
+    vector< double > u_vec, w_vec;
+    for ( int i = 0 ; i < ( int )pmap_u.size() - 1 ; i++ )
+    {
+        for ( int k = 0 ; k < nsub ; k++ )
+        {
+            u_vec.push_back( pmap_u[i] + ( pmap_u[i + 1] - pmap_u[i] ) * k / ( double )nsub );
+        }
+    }
+    u_vec.push_back( pmap_u.back() );
+
+    for ( int j = 0 ; j < ( int )pmap_w.size() - 1 ; j++ )
+    {
+        for ( int k = 0 ; k < nsub ; k++ )
+        {
+            w_vec.push_back( pmap_w[j] + ( pmap_w[j + 1] - pmap_w[j] ) * k / ( double )nsub );
+        }
+    }
+    w_vec.push_back( pmap_w.back() );
+
+    int nu = ( int )u_vec.size();
+    int nw = ( int )w_vec.size();
+
+    vector< vec3d > tess_vec( nu * nw );
+
+    #pragma omp parallel for num_threads( num_threads )
+    for ( int i = 0 ; i < nu ; i++ )
+    {
+        for ( int j = 0 ; j < nw ; j++ )
+        {
+            tess_vec[ i * nw + j ] = CompPnt( u_vec[i], w_vec[j] );
+        }
+    }
+
+    PntNodeCloud cloud;
+    cloud.AddPntNodes( tess_vec );
+
+    PNTree index( 3, cloud, KDTreeSingleIndexAdaptorParams( 10 ) );
+    index.buildIndex();
+
+    #pragma omp parallel for num_threads( num_threads )
+    for ( int i = 0 ; i < npt ; i++ )
+    {
+        size_t ind = 0;
+        double dist_sq = 0.0;
+        index.knnSearch( &pt_vec[i][0], 1, &ind, &dist_sq );
+
+        guess_vec[i].set_xy( u_vec[ ind / nw ], w_vec[ ind % nw ] );
+    }
+}
@@ -7,6 +7,7 @@
 #define SURF_CORE__INCLUDED_
 
 #include "Vec3d.h"
+#include "Vec2d.h"
 
 #include "eli/code_eli.hpp"
 
@@ -27,6 +28,7 @@ using std::vector;
 
 class Bezier_curve;
 class Surf;
+class ContentHash;
 
 //////////////////////////////////////////////////////////////////////
 class SurfCore
@@ -107,6 +109,8 @@ public:
 
     void WriteSurf( FILE* fp ) const;
 
+    void AddToHash( ContentHash & hash ) const;
+
     void MakeWakeSurf( const Bezier_curve &lecrv, double endx, double angle );
     void MakePlaneSurf( const threed_point_type &p0, const threed_point_type &p1, const threed_point_type &p2, const threed_point_type &p3 );
 
@@ -114,6 +118,11 @@ public:
 
     double FindNearest( double &u, double &w, const vec3d &pt, double u0, double w0 ) const;
 
+    //==== Batch Nearest Points - Guesses Seeded From Coarse Tess When guess_vec Is Empty ====//
+    void FindNearest( vector< vec2d > & uw_vec, vector< double > & dist_vec, const vector< vec3d > & pt_vec,
+                      const vector< vec2d > & guess_vec, int num_threads ) const;
+    void SeedNearest( vector< vec2d > & guess_vec, const vector< vec3d > & pt_vec, int num_threads, int nsub = 8 ) const;
+
 protected:
     piecewise_surface_type m_Surface;
 
@@ -31,6 +31,7 @@ using namespace std;
 
 class Surf;
 class SurfPatch;
+struct PatchISeg;
 
 //////////////////////////////////////////////////////////////////////
 class SurfPatch
@@ -75,7 +76,7 @@ public:
     {
         return &bnd_box;
     }
-    friend void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth );
+    friend void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth, vector< PatchISeg > & iseg_vec );
     void find_closest_uw( vec3d& pnt_in, double guess_uw[2], double uw[2] );
     void find_closest_uw( vec3d& pnt_in, double uw[2] );
     vec3d comp_pnt_01( double u, double w );
@@ -99,7 +100,7 @@ public:
         return sub_depth;
     }
 
-    friend void intersect_quads( SurfPatch&  bp1, SurfPatch& bp2 );
+    friend void intersect_quads( SurfPatch&  bp1, SurfPatch& bp2, vector< PatchISeg > & iseg_vec );
 
 protected:
 
@@ -13,6 +13,7 @@
 
 #include "Vec2d.h"
 #include "Vec3d.h"
+#include "MeshList.h"
 
 #define _USE_MATH_DEFINES
 #include <math.h>
@@ -30,7 +31,7 @@ class Edge;
 class Surf;
 
 //////////////////////////////////////////////////////////////////////
-class Node
+class Node : public MeshListLink< Node >
 {
 public:
     Node()
@@ -45,8 +46,6 @@ public:
     }
     virtual ~Node();
 
-    list< Node* >::iterator list_ptr;
-
     bool m_DeleteMeFlag;
 
     vec3d pnt;              // Position
@@ -75,7 +74,7 @@ public:
 
 
 //////////////////////////////////////////////////////////////////////
-class Edge
+class Edge : public MeshListLink< Edge >
 {
 public:
     Edge()
@@ -93,8 +92,6 @@ public:
     }
     virtual ~Edge()                         {}
 
-    list< Edge* >::iterator list_ptr;
-
     bool m_DeleteMeFlag;
 
     Node* n0;
@@ -142,14 +139,13 @@ public:
 };
 
 //////////////////////////////////////////////////////////////////////
-class Tri
+class Tri : public MeshListLink< Tri >
 {
 public:
     Tri();
     Tri( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge* ee2 );
     virtual ~Tri();
 
-    list< Tri* >::iterator list_ptr;
     bool m_DeleteMeFlag;
 
     Node* n0;
@@ -639,18 +639,26 @@ struct memorypool {
 };
 
 
+/* Globals are per thread so triangulate() may run on several threads.      */
+
+#ifdef _MSC_VER
+#define TRI_THREAD_LOCAL __declspec(thread)
+#else
+#define TRI_THREAD_LOCAL __thread
+#endif
+
 /* Global constants.                                                         */
 
-REAL splitter;       /* Used to split REAL factors for exact multiplication. */
-REAL epsilon;                             /* Floating-point machine epsilon. */
-REAL resulterrbound;
-REAL ccwerrboundA, ccwerrboundB, ccwerrboundC;
-REAL iccerrboundA, iccerrboundB, iccerrboundC;
-REAL o3derrboundA, o3derrboundB, o3derrboundC;
+TRI_THREAD_LOCAL REAL splitter;  /* Used to split REAL factors for exact mult. */
+TRI_THREAD_LOCAL REAL epsilon;            /* Floating-point machine epsilon. */
+TRI_THREAD_LOCAL REAL resulterrbound;
+TRI_THREAD_LOCAL REAL ccwerrboundA, ccwerrboundB, ccwerrboundC;
+TRI_THREAD_LOCAL REAL iccerrboundA, iccerrboundB, iccerrboundC;
+TRI_THREAD_LOCAL REAL o3derrboundA, o3derrboundB, o3derrboundC;
 
 /* Random number seed is not constant, but I've made it global anyway.       */
 
-unsigned long randomseed;                     /* Current random number seed. */
+TRI_THREAD_LOCAL unsigned long randomseed;    /* Current random number seed. */
 
 
 /* Mesh data structure.  Triangle operates on only one mesh, but the mesh    */
@@ -253,6 +253,9 @@ enum CFD_CONTROL_TYPE {     CFD_MIN_EDGE_LEN,
                             CFD_WAKE_SCALE,
                             CFD_WAKE_ANGLE,
                             CFD_SRF_XYZ_FLAG,
+                            CFD_NUM_THREADS,
+                            CFD_REUSE_MESH_FLAG,
+                            CFD_QUEUE_REMESH_FLAG,
 };
 
 enum CFD_MESH_SOURCE_TYPE { POINT_SOURCE,
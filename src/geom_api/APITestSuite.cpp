@@ -7,7 +7,9 @@
 
 #include "VSP_Geom_API.h"
 #include "APITestSuite.h"
+#include "Defines.h"
 #include <float.h>
+#include <algorithm>
 
 //Default tolerance to use for tests.  Most calculations are done as doubles and choosing single precision FLT_MIN gives some allowance for precision stackup in calculations
 #define TEST_TOL FLT_MIN
@@ -346,6 +348,415 @@ void APITestSuite::TestDXFExport()
     printf( "\n" );
 }
 
+//==== Whole File As A String, Empty If It Can Not Be Read ====//
+static string ReadFileContents( const string & file_name )
+{
+    string contents;
+    FILE* fp = fopen( file_name.c_str(), "rb" );
+    if ( fp )
+    {
+        char buf[4096];
+        size_t n;
+        while ( ( n = fread( buf, 1, sizeof( buf ), fp ) ) > 0 )
+        {
+            contents.append( buf, n );
+        }
+        fclose( fp );
+    }
+    return contents;
+}
+
+//==== Number Of Surfs Of geom_id That Were And Were Not Reused In The Last CFD Mesh ====//
+static void CountReusedSurfs( const string & geom_id, int & num_reused, int & num_remeshed )
+{
+    num_reused = num_remeshed = 0;
+
+    string res_id = vsp::FindLatestResultsID( "CFDMesh_Profile" );
+    vector< string > surf_geom_vec = vsp::GetStringResults( res_id, "Surf_Geom_ID" );
+    vector< int > surf_reused_vec = vsp::GetIntResults( res_id, "Surf_Reused" );
+
+    for ( int i = 0 ; i < ( int )surf_geom_vec.size() && i < ( int )surf_reused_vec.size() ; i++ )
+    {
+        if ( geom_id.empty() || surf_geom_vec[i] == geom_id )
+        {
+            if ( surf_reused_vec[i] )
+            {
+                num_reused++;
+            }
+            else
+            {
+                num_remeshed++;
+            }
+        }
+    }
+}
+
+void APITestSuite::TestCFDMeshWing()
+{
+    printf( "APITestSuite::TestCFDMeshWing()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Add Wing Geom and set some parameters =====//
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT( wing_id.c_str() != NULL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "TotalSpan", "WingGeom", 30.0 ), 30.0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Dense Mesh So Remesh Dominates ====//
+    vsp::SetCFDMeshVal( vsp::CFD_MAX_EDGE_LEN, 0.1 );
+    vsp::SetCFDMeshVal( vsp::CFD_MIN_EDGE_LEN, 0.01 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::CFD_STL_TYPE );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Stage Profile ====//
+    string res_id = vsp::FindLatestResultsID( "CFDMesh_Profile" );
+    TEST_ASSERT( res_id.size() > 0 );
+    vector< string > stage_vec = vsp::GetStringResults( res_id, "Stage_Name" );
+    vector< double > wall_vec = vsp::GetDoubleResults( res_id, "Wall_Time" );
+    TEST_ASSERT( stage_vec.size() == 8 );
+    TEST_ASSERT( wall_vec.size() == stage_vec.size() );
+
+    //==== Remesh Work and Node/Edge/Tri Storage ====//
+    vector< double > mem_vec = vsp::GetDoubleResults( res_id, "Remesh_Peak_Memory_KB" );
+    vector< int > split_vec = vsp::GetIntResults( res_id, "Remesh_Splits" );
+    vector< int > collapse_vec = vsp::GetIntResults( res_id, "Remesh_Collapses" );
+    vector< int > tri_vec = vsp::GetIntResults( res_id, "Num_Tris" );
+    vector< double > rss_vec = vsp::GetDoubleResults( res_id, "Peak_RSS_Delta_KB" );
+    TEST_ASSERT( mem_vec.size() == 1 && split_vec.size() == 1 && collapse_vec.size() == 1 );
+    TEST_ASSERT( tri_vec.size() == stage_vec.size() );
+    TEST_ASSERT( rss_vec.size() == stage_vec.size() );
+
+    int remesh_stage = ( int )( std::find( stage_vec.begin(), stage_vec.end(), "Remesh" ) - stage_vec.begin() );
+    TEST_ASSERT( remesh_stage < ( int )stage_vec.size() );
+    if ( mem_vec.size() == 1 && split_vec.size() == 1 && collapse_vec.size() == 1 &&
+         remesh_stage < ( int )wall_vec.size() && remesh_stage < ( int )tri_vec.size() &&
+         remesh_stage < ( int )rss_vec.size() )
+    {
+        TEST_ASSERT( mem_vec[0] > 0.0 );
+        TEST_ASSERT( split_vec[0] > 0 && collapse_vec[0] > 0 );
+
+        //==== Pooled Storage Leaves The Mesh Unchanged - 86110 Tris Before It ====//
+        TEST_ASSERT_DELTA( ( double )tri_vec[remesh_stage], 86110.0, 0.02 * 86110.0 );
+        TEST_ASSERT( tri_vec.back() == tri_vec[remesh_stage] );
+    }
+
+    //==== Sweep vs Queue Split/Collapse ====//
+    vector< int > visit_vec = vsp::GetIntResults( res_id, "Remesh_Edge_Visits" );
+    TEST_ASSERT( visit_vec.size() == 1 );
+
+    //==== Reuse Stays On - Switching Mode Alone Must Remesh Every Surf ====//
+    vsp::SetCFDMeshVal( vsp::CFD_QUEUE_REMESH_FLAG, 1 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::CFD_STL_TYPE );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string queue_res_id = vsp::FindLatestResultsID( "CFDMesh_Profile" );
+    vector< int > queue_visit_vec = vsp::GetIntResults( queue_res_id, "Remesh_Edge_Visits" );
+    vector< int > queue_tri_vec = vsp::GetIntResults( queue_res_id, "Num_Tris" );
+    TEST_ASSERT( queue_visit_vec.size() == 1 );
+    TEST_ASSERT( queue_tri_vec.size() == tri_vec.size() );
+
+    int num_reused, num_remeshed;
+    CountReusedSurfs( "", num_reused, num_remeshed );
+    TEST_ASSERT( num_reused == 0 );
+    TEST_ASSERT( num_remeshed > 0 );
+
+    //==== Queue Does Less Work For A Mesh Of About The Same Size ====//
+    if ( visit_vec.size() == 1 && queue_visit_vec.size() == 1 )
+    {
+        TEST_ASSERT( visit_vec[0] > 0 && queue_visit_vec[0] > 0 );
+        TEST_ASSERT( queue_visit_vec[0] < visit_vec[0] );
+    }
+    if ( remesh_stage < ( int )tri_vec.size() && remesh_stage < ( int )queue_tri_vec.size() )
+    {
+        TEST_ASSERT_DELTA( ( double )queue_tri_vec[remesh_stage], ( double )tri_vec[remesh_stage], 0.05 * tri_vec[remesh_stage] );
+    }
+    printf( "\n" );
+
+    vsp::SetCFDMeshVal( vsp::CFD_QUEUE_REMESH_FLAG, 0 );
+}
+
+void APITestSuite::TestCFDMeshReuse()
+{
+    printf( "APITestSuite::TestCFDMeshReuse()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Wing With A Pod Through Its Root and A Pod Well Clear Of Both ====//
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "TotalSpan", "WingGeom", 30.0 ), 30.0, TEST_TOL );
+
+    string near_pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( near_pod_id, "X_Rel_Location", "XForm", -3.0 ), -3.0, TEST_TOL );
+
+    string far_pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( far_pod_id, "Z_Rel_Location", "XForm", 20.0 ), 20.0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::SetCFDMeshVal( vsp::CFD_MAX_EDGE_LEN, 0.5 );
+    vsp::SetCFDMeshVal( vsp::CFD_MIN_EDGE_LEN, 0.05 );
+    vsp::SetCFDMeshVal( vsp::CFD_REUSE_MESH_FLAG, 1 );
+    vsp::SetCFDMeshVal( vsp::CFD_QUEUE_REMESH_FLAG, 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    int num_reused, num_remeshed;
+
+    //==== First Mesh Builds Every Surf ====//
+    vsp::SetComputationFileName( vsp::CFD_STL_TYPE, "TestCFDMeshReuse_First.stl" );
+    vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::CFD_STL_TYPE );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    CountReusedSurfs( "", num_reused, num_remeshed );
+    TEST_ASSERT( num_reused == 0 );
+    TEST_ASSERT( num_remeshed >= 4 );
+    int num_surfs = num_reused + num_remeshed;
+
+    //==== Unchanged Model Reuses Every Surf With The Same Tris ====//
+    vsp::SetComputationFileName( vsp::CFD_STL_TYPE, "TestCFDMeshReuse_Same.stl" );
+    vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::CFD_STL_TYPE );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    CountReusedSurfs( "", num_reused, num_remeshed );
+    TEST_ASSERT( num_reused == num_surfs );
+    TEST_ASSERT( num_remeshed == 0 );
+
+    string first_stl = ReadFileContents( "TestCFDMeshReuse_First.stl" );
+    TEST_ASSERT( first_stl.size() > 0 );
+    TEST_ASSERT( first_stl == ReadFileContents( "TestCFDMeshReuse_Same.stl" ) );
+
+    //==== Changing The Near Pod Remeshes It and The Wing Surfs It Cuts, Not The Far Pod ====//
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( near_pod_id, "FineRatio", "Design", 10.0 ), 10.0, TEST_TOL );
+    vsp::SetComputationFileName( vsp::CFD_STL_TYPE, "TestCFDMeshReuse_Pod.stl" );
+    vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::CFD_STL_TYPE );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    CountReusedSurfs( near_pod_id, num_reused, num_remeshed );
+    TEST_ASSERT( num_reused == 0 && num_remeshed > 0 );
+    CountReusedSurfs( wing_id, num_reused, num_remeshed );
+    TEST_ASSERT( num_remeshed > 0 );
+    CountReusedSurfs( far_pod_id, num_reused, num_remeshed );
+    TEST_ASSERT( num_reused > 0 && num_remeshed == 0 );
+
+    //==== Turning Reuse Off Forces Every Surf To Be Rebuilt ====//
+    vsp::SetCFDMeshVal( vsp::CFD_REUSE_MESH_FLAG, 0 );
+    vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::CFD_STL_TYPE );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    CountReusedSurfs( "", num_reused, num_remeshed );
+    TEST_ASSERT( num_reused == 0 );
+    TEST_ASSERT( num_remeshed == num_surfs );
+
+    vsp::SetCFDMeshVal( vsp::CFD_REUSE_MESH_FLAG, 1 );
+    printf( "\n" );
+}
+
+void APITestSuite::TestCompGeomWingBody()
+{
+    printf( "APITestSuite::TestCompGeomWingBody()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Dense Wing, Fuselage and Pod So Tri Intersection Dominates =====//
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT( wing_id.c_str() != NULL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "TotalSpan", "WingGeom", 30.0 ), 30.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "SectTess_U", "XSec_1", 60 ), 60, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  wing_id, "Tess_W", "Shape", 81 ), 81, TEST_TOL );
+
+    string fus_id = vsp::AddGeom( "FUSELAGE" );
+    TEST_ASSERT( fus_id.c_str() != NULL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  fus_id, "X_Rel_Location", "XForm", -9.0 ), -9.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  fus_id, "Z_Rel_Location", "XForm", -1.0 ), -1.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  fus_id, "Tess_U", "Shape", 81 ), 81, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  fus_id, "Tess_W", "Shape", 81 ), 81, TEST_TOL );
+
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT( pod_id.c_str() != NULL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  pod_id, "Y_Rel_Location", "XForm", 5.0 ), 5.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  pod_id, "Tess_U", "Shape", 41 ), 41, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  pod_id, "Tess_W", "Shape", 41 ), 41, TEST_TOL );
+    vsp::SetParmValUpdate( pod_id, "Sym_Planar_Flag", "Sym", vsp::SYM_XZ  );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string mesh_id = vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    TEST_ASSERT( mesh_id.size() > 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Intersection Removes Buried Area and Volume - Values From Before The BVH ====//
+    string res_id = vsp::FindLatestResultsID( "Comp_Geom" );
+    TEST_ASSERT( res_id.size() > 0 );
+    vector< double > theo_area = vsp::GetDoubleResults( res_id, "Total_Theo_Area" );
+    vector< double > wet_area = vsp::GetDoubleResults( res_id, "Total_Wet_Area" );
+    vector< double > theo_vol = vsp::GetDoubleResults( res_id, "Total_Theo_Vol" );
+    vector< double > wet_vol = vsp::GetDoubleResults( res_id, "Total_Wet_Vol" );
+    TEST_ASSERT( theo_area.size() == 1 && wet_area.size() == 1 && theo_vol.size() == 1 && wet_vol.size() == 1 );
+    if ( theo_area.size() == 1 && wet_area.size() == 1 && theo_vol.size() == 1 && wet_vol.size() == 1 )
+    {
+        TEST_ASSERT( wet_area[0] > 0.0 && wet_area[0] < theo_area[0] );
+        TEST_ASSERT( wet_vol[0] > 0.0 && wet_vol[0] < theo_vol[0] );
+        TEST_ASSERT_DELTA( theo_area[0], 446.5552897, 1.0e-6 * 446.5552897 );
+        TEST_ASSERT_DELTA( wet_area[0], 411.2649844, 1.0e-6 * 411.2649844 );
+        TEST_ASSERT_DELTA( theo_vol[0], 178.9316365, 1.0e-6 * 178.9316365 );
+        TEST_ASSERT_DELTA( wet_vol[0], 175.4172807, 1.0e-6 * 175.4172807 );
+    }
+    printf( "\n" );
+}
+
+void APITestSuite::TestSlicesPod()
+{
+    printf( "APITestSuite::TestSlicesPod()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT( pod_id.c_str() != NULL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  pod_id, "Tess_U", "Shape", 41 ), 41, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate(  pod_id, "Tess_W", "Shape", 41 ), 41, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Reference Volume From CompGeom - Each Result Mesh Is Removed So Only The Pod Is Sliced ====//
+    string mesh_id = vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    vsp::DeleteGeom( mesh_id );
+    string res_id = vsp::FindLatestResultsID( "Comp_Geom" );
+    TEST_ASSERT( res_id.size() > 0 );
+    vector< double > wet_vol = vsp::GetDoubleResults( res_id, "Total_Wet_Vol" );
+    TEST_ASSERT( wet_vol.size() == 1 );
+    if ( wet_vol.size() != 1 )
+    {
+        return;
+    }
+
+    //==== Slice Volume Matches Mesh Volume ====//
+    mesh_id = vsp::ComputeMassProps( vsp::SET_ALL, 500 );
+    vsp::DeleteGeom( mesh_id );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    res_id = vsp::FindLatestResultsID( "Mass_Properties" );
+    TEST_ASSERT( res_id.size() > 0 );
+    vector< double > mass_vol = vsp::GetDoubleResults( res_id, "Total_Volume" );
+    TEST_ASSERT( mass_vol.size() == 1 );
+    if ( mass_vol.size() == 1 )
+    {
+        TEST_ASSERT_DELTA( mass_vol[0], wet_vol[0], 0.01 * wet_vol[0] );
+    }
+
+    //==== Integrated Area Slices Match Mesh Volume ====//
+    mesh_id = vsp::ComputePlaneSlice( vsp::SET_ALL, 500, vec3d( 1.0, 0.0, 0.0 ), true );
+    vsp::DeleteGeom( mesh_id );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    res_id = vsp::FindLatestResultsID( "Slice" );
+    TEST_ASSERT( res_id.size() > 0 );
+    vector< double > loc_vec = vsp::GetDoubleResults( res_id, "Slice_Loc" );
+    vector< double > area_vec = vsp::GetDoubleResults( res_id, "Slice_Area" );
+    TEST_ASSERT( loc_vec.size() == 500 && area_vec.size() == 500 );
+    if ( loc_vec.size() == 500 && area_vec.size() == 500 )
+    {
+        double slice_vol = 0.0;
+        for ( int i = 1 ; i < ( int )loc_vec.size() ; i++ )
+        {
+            slice_vol += 0.5 * ( area_vec[i] + area_vec[i - 1] ) * ( loc_vec[i] - loc_vec[i - 1] );
+        }
+        TEST_ASSERT_DELTA( slice_vol, wet_vol[0], 0.01 * wet_vol[0] );
+        printf( "\tMesh Vol: %f  Mass Vol: %f  Slice Vol: %f\n", wet_vol[0], mass_vol.size() ? mass_vol[0] : 0.0, slice_vol );
+    }
+    printf( "\n" );
+}
+
+void APITestSuite::TestClearancePods()
+{
+    printf( "APITestSuite::TestClearancePods()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    string move_id = vsp::AddGeom( "POD" );
+    string other_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT( move_id.c_str() != NULL );
+    TEST_ASSERT( other_id.c_str() != NULL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( other_id, "Y_Rel_Location", "XForm", 3.0 ), 3.0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    double d0 = vsp::ComputeMinClearanceDistance( move_id, vsp::SET_ALL );
+    TEST_ASSERT( d0 > 0.0 );
+
+    //==== Repeat Query Reuses Other Geom Meshes ====//
+    double d1 = vsp::ComputeMinClearanceDistance( move_id, vsp::SET_ALL );
+    TEST_ASSERT_DELTA( d1, d0, TEST_TOL );
+
+    //==== Moving Geom Changes - Other Meshes Still Valid ====//
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( move_id, "Y_Rel_Location", "XForm", -1.0 ), -1.0, TEST_TOL );
+    double d2 = vsp::ComputeMinClearanceDistance( move_id, vsp::SET_ALL );
+    TEST_ASSERT_DELTA( d2, d0 + 1.0, 1.0e-3 );
+
+    //==== Other Geom Changes - Meshes Must Be Rebuilt ====//
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( other_id, "Y_Rel_Location", "XForm", 4.0 ), 4.0, TEST_TOL );
+    double d3 = vsp::ComputeMinClearanceDistance( move_id, vsp::SET_ALL );
+    TEST_ASSERT_DELTA( d3, d0 + 2.0, 1.0e-3 );
+
+    printf( "\tClearance: %f  %f  %f\n", d0, d2, d3 );
+
+    //==== Other Surface Changes Without A Parm Change - Flipping An S Camber Line ====//
+    //==== Mirrors Each Section, So Bounding Box and Panel Width Parms Stay Put  ====//
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT( wing_id.c_str() != NULL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "Z_Rel_Location", "XForm", -2.0 ), -2.0, TEST_TOL );
+    string xsec_surf = vsp::GetXSecSurf( wing_id, 0 );
+    vsp::ChangeXSecShape( xsec_surf, 0, vsp::XS_FILE_AIRFOIL );
+    vsp::ChangeXSecShape( xsec_surf, 1, vsp::XS_FILE_AIRFOIL );
+
+    vector< vec3d > fwd_up_vec, fwd_low_vec, aft_up_vec, aft_low_vec;
+    for ( int i = 0 ; i < 41 ; i++ )
+    {
+        double x = i / 40.0;
+        double t = 0.1 * sin( PI * x );
+        double c = 0.05 * sin( 2.0 * PI * x );
+        fwd_up_vec.push_back( vec3d( x, c + t, 0.0 ) );
+        fwd_low_vec.push_back( vec3d( x, c - t, 0.0 ) );
+        aft_up_vec.push_back( vec3d( x, t - c, 0.0 ) );
+        aft_low_vec.push_back( vec3d( x, -c - t, 0.0 ) );
+    }
+    vsp::SetAirfoilPnts( vsp::GetXSec( xsec_surf, 0 ), fwd_up_vec, fwd_low_vec );
+    vsp::SetAirfoilPnts( vsp::GetXSec( xsec_surf, 1 ), fwd_up_vec, fwd_low_vec );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    double d4 = vsp::ComputeMinClearanceDistance( move_id, vsp::SET_ALL );
+
+    vsp::SetAirfoilPnts( vsp::GetXSec( xsec_surf, 0 ), aft_up_vec, aft_low_vec );
+    vsp::SetAirfoilPnts( vsp::GetXSec( xsec_surf, 1 ), aft_up_vec, aft_low_vec );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    double d5 = vsp::ComputeMinClearanceDistance( move_id, vsp::SET_ALL );
+
+    TEST_ASSERT( d5 < d4 - 0.01 );
+
+    //==== Matches Meshes Rebuilt From Scratch - Another Moving Geom Drops The Cache ====//
+    vsp::ComputeMinClearanceDistance( other_id, vsp::SET_ALL );
+    double d6 = vsp::ComputeMinClearanceDistance( move_id, vsp::SET_ALL );
+    TEST_ASSERT_DELTA( d5, d6, TEST_TOL );
+
+    printf( "\tFile Airfoil Clearance: %f  %f\n", d4, d5 );
+    printf( "\n" );
+}
+
 
 //=============================================================================//
 //========================== APITestSuiteVSPAERO ==============================//
@@ -31,6 +31,15 @@ public:
 
         // Export
         TEST_ADD( APITestSuite::TestDXFExport )
+        // CFD Mesh
+        TEST_ADD( APITestSuite::TestCFDMeshWing )
+        TEST_ADD( APITestSuite::TestCFDMeshReuse )
+        // CompGeom
+        TEST_ADD( APITestSuite::TestCompGeomWingBody )
+        // Slicing
+        TEST_ADD( APITestSuite::TestSlicesPod )
+        // Clearance
+        TEST_ADD( APITestSuite::TestClearancePods )
 
     }
 
@@ -46,6 +55,15 @@ private:
     void TestAnalysesWithPod();
     // Export
     void TestDXFExport();
+    // CFD Mesh
+    void TestCFDMeshWing();
+    void TestCFDMeshReuse();
+    // CompGeom
+    void TestCompGeomWingBody();
+    // Slicing
+    void TestSlicesPod();
+    // Clearance
+    void TestClearancePods();
 };
 
 class APITestSuiteVSPAERO : public Test::Suite
@@ -521,6 +521,12 @@ void SetCFDMeshVal( int type, double val )
         CfdMeshMgr.GetCfdSettingsPtr()->m_WakeAngle = val;
     else if ( type == CFD_SRF_XYZ_FLAG )
         CfdMeshMgr.GetCfdSettingsPtr()->m_XYZIntCurveFlag = ToBool(val);
+    else if ( type == CFD_NUM_THREADS )
+        CfdMeshMgr.GetCfdSettingsPtr()->m_NumThreads = ( int )val;
+    else if ( type == CFD_REUSE_MESH_FLAG )
+        CfdMeshMgr.GetCfdSettingsPtr()->m_ReuseMeshFlag = ToBool(val);
+    else if ( type == CFD_QUEUE_REMESH_FLAG )
+        CfdMeshMgr.GetCfdSettingsPtr()->m_QueueRemeshFlag = ToBool(val);
     else
     {
         ErrorMgr.AddError( VSP_CANT_FIND_TYPE, "SetCFDMeshVal::Can't Find Type " + to_string( ( long long )type ) );
@@ -597,6 +603,13 @@ void AddCFDSource( int type, const string & geom_id, int surf_index,
 
 }
 
+/// Write A Chrome Trace Of The Mesh Stages On Each ComputeCFDMesh - Empty For None
+void SetCFDMeshTraceFileName( const string & file_name )
+{
+    CfdMeshMgr.SetTraceFileName( file_name );
+    ErrorMgr.NoError();
+}
+
 /// Delete All CFD Sources
 void DeleteAllCFDSources()
 {
@@ -2143,6 +2156,7 @@ void SetAirfoilPnts( const string& xsec_id, std::vector< vec3d > & up_pnt_vec, s
     FileAirfoil* file_xs = dynamic_cast<FileAirfoil*>( xs->GetXSecCurve() );
     assert( file_xs );
     file_xs->SetAirfoilPnts( up_pnt_vec, low_pnt_vec );
+    file_xs->ParmChanged( NULL, Parm::SET_FROM_DEVICE ); // Force Update
     ErrorMgr.NoError();
 }
 
@@ -69,6 +69,7 @@ extern void ComputeDegenGeom( int set, int file_export_types );
 extern void ComputeCFDMesh( int set, int file_export_types );
 extern void SetCFDMeshVal( int type, double val );
 extern void SetCFDWakeFlag( const std::string & geom_id, bool flag );
+extern void SetCFDMeshTraceFileName( const std::string & file_name );
 extern void DeleteAllCFDSources();
 extern void AddDefaultSources();
 extern void AddCFDSource( int type, const std::string & geom_id, int surf_index,
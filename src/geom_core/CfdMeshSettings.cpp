@@ -75,6 +75,15 @@ CfdMeshSettings::CfdMeshSettings() : ParmContainer()
     m_IntersectSubSurfs.Init( "IntersectSubSurfs", "Global", this, true, 0, 1 );
     m_IntersectSubSurfs.SetDescript( "Flag to intersect subsurfaces" );
 
+    m_NumThreads.Init( "NumThreads", "Global", this, 0, 0, 1024 );
+    m_NumThreads.SetDescript( "Number of threads used for meshing, zero uses all available cores" );
+
+    m_ReuseMeshFlag.Init( "ReuseMesh", "Global", this, true, 0, 1 );
+    m_ReuseMeshFlag.SetDescript( "Flag to reuse surface meshes whose inputs are unchanged since the last mesh" );
+
+    m_QueueRemeshFlag.Init( "QueueRemesh", "Global", this, false, 0, 1 );
+    m_QueueRemeshFlag.SetDescript( "Flag to split and collapse edges from a worst-first queue instead of full sweeps" );
+
     m_SelectedSetIndex.Init( "Set", "Global", this, 0, 0, 12 );
     m_SelectedSetIndex.SetDescript( "Selected set for operation" );
 
@@ -112,6 +112,21 @@ public:
         return m_IntersectSubSurfs();
     }
 
+    virtual int GetNumThreads()
+    {
+        return m_NumThreads();
+    }
+
+    virtual bool GetReuseMeshFlag()
+    {
+        return m_ReuseMeshFlag();
+    }
+
+    virtual bool GetQueueRemeshFlag()
+    {
+        return m_QueueRemeshFlag();
+    }
+
     string GetExportFileName( int type );
     void SetExportFileName( const string &fn, int type );
     void ResetExportFileNames();
@@ -158,6 +173,12 @@ public:
 
     BoolParm m_IntersectSubSurfs;
 
+    IntParm m_NumThreads;
+
+    BoolParm m_ReuseMeshFlag;
+
+    BoolParm m_QueueRemeshFlag;
+
     IntParm m_SelectedSetIndex;
 
     BoolParm m_ExportFileFlags[vsp::CFD_NUM_FILE_NAMES];
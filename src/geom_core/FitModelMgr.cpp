@@ -675,12 +675,11 @@ void FitModelMgrSingleton::RefineTargetUW()
 
     int npt = m_TargetPts.size();
 
+    // Target points are independent, geoms were found in ValidateTargetPts
+    #pragma omp parallel for schedule( dynamic )
     for ( int i = 0 ; i < npt; i++ )
     {
-        TargetPt* tpt = m_TargetPts[i];
-        Geom* g = VehicleMgr.GetVehicle()->FindGeom( tpt->GetMatchGeom() );
-
-        tpt->RefineUW( g );
+        m_TargetPts[i]->RefineUW( m_TargetGeomPtrVec[i] );
     }
 }
 
@@ -690,12 +689,11 @@ void FitModelMgrSingleton::SearchTargetUW()
 
     int npt = m_TargetPts.size();
 
+    // Target points are independent, geoms were found in ValidateTargetPts
+    #pragma omp parallel for schedule( dynamic )
     for ( int i = 0 ; i < npt; i++ )
     {
-        TargetPt* tpt = m_TargetPts[i];
-        Geom* g = VehicleMgr.GetVehicle()->FindGeom( tpt->GetMatchGeom() );
-
-        tpt->SearchUW( g );
+        m_TargetPts[i]->SearchUW( m_TargetGeomPtrVec[i] );
     }
 }
 
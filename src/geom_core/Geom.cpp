@@ -13,6 +13,7 @@
 #include "ParmMgr.h"
 #include "SubSurfaceMgr.h"
 #include "HingeGeom.h"
+#include "ContentHash.h"
 using namespace vsp;
 
 //==== Constructor ====//
@@ -741,6 +742,8 @@ void GeomXForm::AcceptScale()
 Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
 {
     m_UpdateBlock = false;
+    m_SurfChangeCnt = 0;
+    m_SurfHash = 0;
 
     m_Name = "Geom";
     m_Type.m_Type = GEOM_GEOM_TYPE;
@@ -945,6 +948,8 @@ void Geom::Update( bool fullupdate )
 
     UpdateSymmAttach();
 
+    UpdateSurfChangeCnt();
+
     if ( fullupdate )
     {
         for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
@@ -1304,6 +1309,23 @@ void Geom::UpdateSymmAttach()
 }
 
 //==== Check If Children Exist and Update ====//
+//==== Surfaces Can Change Without A Parm Change (e.g. File XSec Points) ====//
+void Geom::UpdateSurfChangeCnt()
+{
+    ContentHash hash;
+    hash.Add( ( int )m_SurfVec.size() );
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        m_SurfVec[i].AddToHash( hash );
+    }
+
+    if ( hash.Get() != m_SurfHash )
+    {
+        m_SurfHash = hash.Get();
+        m_SurfChangeCnt++;
+    }
+}
+
 void Geom::UpdateChildren( bool fullupdate )
 {
     vector< string > updated_child_vec;
@@ -364,6 +364,12 @@ public:
     virtual int GetNumTotalSurfs();
     virtual int GetNumSymmCopies();
 
+    //==== Bumped By Update Only When The Surfaces Actually Change ====//
+    int GetSurfChangeCnt()
+    {
+        return m_SurfChangeCnt;
+    }
+
     virtual vector < int > & GetSymmIndexs( int imain )
     {
         return m_SurfSymmMap[ imain ];
@@ -425,6 +431,10 @@ public:
     virtual void WritePLOT3DFileExtents( FILE* dump_file );
     virtual void WritePLOT3DFileXYZ( FILE* dump_file );
     virtual void WriteStl( FILE* fid ) {};
+    virtual int  WriteBinStl( FILE* fid )
+    {
+        return 0;
+    }
     virtual void WriteX3D( xmlNodePtr node );
     virtual void WritePovRay( FILE* fid, int comp_num );
     virtual void WritePovRayTri( FILE* fid, const vec3d& v, const vec3d& n, bool comma = true );
@@ -573,6 +583,7 @@ protected:
     virtual void UpdateFeatureLines();
     virtual void UpdateFlags();
     virtual void UpdateSymmAttach();
+    void UpdateSurfChangeCnt();
     virtual void UpdateChildren( bool fullupdate );
     virtual void UpdateBBox();
     virtual void UpdateDrawObj();
@@ -588,6 +599,8 @@ protected:
     vector<VspSurf> m_SurfVec;
     vector<int> m_SurfIndxVec;
     vector< vector< int > > m_SurfSymmMap;
+    int m_SurfChangeCnt;
+    unsigned long long m_SurfHash;
     vector<DrawObj> m_WireShadeDrawObj_vec;
     vector<DrawObj> m_FeatureDrawObj_vec;
     DrawObj m_HighlightDrawObj;
@@ -7,7 +7,14 @@
 
 #include "GeomCoreTestSuite.h"
 #include "MeshGeom.h"
+#include "PtCloudGeom.h"
+#include "ParmMgr.h"
+#include "VehicleMgr.h"
 #include "StlHelper.h"
+#include "StlFile.h"
+#include "ParallelUtil.h"
+
+#include <cstring>
 
 
 //==== Test GeomXForm ====//
@@ -187,6 +194,51 @@ void GeomCoreTestSuite::XmlTest()
         TEST_ASSERT( fabs( dbl_vec[i] - dbl_ret_vec[i] ) < DBL_EPSILON  );
     }
 
+    //==== Blob Spanning Several Chunks, Half Compressible And Half Not ====//
+    vector< unsigned char > blob( 5 * 1024 * 1024 + 17 );
+    unsigned int seed = 12345;
+    for ( int i = 0 ; i < ( int )blob.size() ; i++ )
+    {
+        seed = seed * 1103515245 + 12345;
+        blob[i] = ( i < ( int )blob.size() / 2 ) ? ( unsigned char )( i % 7 ) : ( unsigned char )( seed >> 24 );
+    }
+    XmlUtil::AddBlobNode( root, "Blob_Test", blob );
+
+    vector< unsigned char > blob_ret;
+    TEST_ASSERT( XmlUtil::ExtractBlobNode( XmlUtil::GetNode( root, "Blob_Test", 0 ), blob_ret ) );
+    TEST_ASSERT( blob_ret == blob );
+
+    //==== Compressible and Incompressible Chunks Interleaved, Encoded and Decoded By Several Threads ====//
+    vector< unsigned char > mixed_blob( 16 * 1024 * 1024 + 5 );
+    for ( int i = 0 ; i < ( int )mixed_blob.size() ; i++ )
+    {
+        seed = seed * 1103515245 + 12345;
+        mixed_blob[i] = ( ( i >> 20 ) % 2 == 0 ) ? ( unsigned char )( i % 11 ) : ( unsigned char )( seed >> 24 );
+    }
+
+    int num_threads = GetMaxNumThreads();
+    SetMaxNumThreads( 4 );
+    for ( int pass = 0 ; pass < 4 ; pass++ )
+    {
+        xmlNodePtr mixed_node = XmlUtil::AddBlobNode( root, "Mixed_Blob_Test", mixed_blob );
+        TEST_ASSERT( XmlUtil::FindIntProp( mixed_node, "Num_Chunks", 0 ) == 17 );
+
+        int num_zlib = 0;
+        for ( xmlNodePtr chunk_node = mixed_node->xmlChildrenNode ; chunk_node != NULL ; chunk_node = chunk_node->next )
+        {
+            num_zlib += XmlUtil::FindIntProp( chunk_node, "Zlib", 0 );
+        }
+        TEST_ASSERT( num_zlib == 8 );
+
+        vector< unsigned char > mixed_ret;
+        TEST_ASSERT( XmlUtil::ExtractBlobNode( mixed_node, mixed_ret ) );
+        TEST_ASSERT( mixed_ret == mixed_blob );
+
+        xmlUnlinkNode( mixed_node );
+        xmlFreeNode( mixed_node );
+    }
+    SetMaxNumThreads( num_threads );
+
     xmlFreeNode( root );
 }
 
@@ -241,6 +293,231 @@ void GeomCoreTestSuite::MeshIOTest()
     veh.CutActiveGeomVec();
 }
 
+//==== Test Binary STL and TRI Export ====//
+void GeomCoreTestSuite::MeshBinIOTest()
+{
+    //==== Init Adds The Sets Geoms Are Written By - It Needs The Global Vehicle Built First ====//
+    VehicleMgr.GetVehicle();
+    Vehicle veh;
+    veh.Init();
+
+    GeomType type;
+    type.m_Type = POD_GEOM_TYPE;
+    type.m_Name = "POD";
+
+    string id0 = veh.AddGeom( type );
+
+    string mesh_orig = veh.AddMeshGeom( 0 );
+    TEST_ASSERT( mesh_orig.compare( "NONE" ) != 0 );
+
+    string out_file = "stl_txt_test.stl";
+    veh.WriteSTLFile( out_file, 0 );
+
+    //==== Binary STL Must Hold The Same Facets As The Text STL ====//
+    out_file = "stl_bin_test.stl";
+    veh.WriteBinSTLFile( out_file, 0 );
+    StlFile stl_txt, stl_bin;
+    TEST_ASSERT( stl_txt.Read( "stl_txt_test.stl" ) );
+    TEST_ASSERT( stl_bin.Read( out_file ) );
+    TEST_ASSERT( !stl_txt.IsBinary() );
+    TEST_ASSERT( stl_bin.IsBinary() );
+    TEST_ASSERT( stl_bin.GetNumFacets() > 0 );
+    TEST_ASSERT( stl_bin.GetNumFacets() == stl_txt.GetNumFacets() );
+    TEST_ASSERT( stl_bin.m_PntVec.size() == stl_txt.m_PntVec.size() );
+    int num_bad = 0;
+    for ( int i = 0 ; i < ( int )stl_bin.m_PntVec.size() && i < ( int )stl_txt.m_PntVec.size() ; i++ )
+    {
+        if ( fabs( stl_bin.m_PntVec[i] - stl_txt.m_PntVec[i] ) > 1.0e-6 * ( 1.0 + fabs( stl_txt.m_PntVec[i] ) ) )
+        {
+            num_bad++;
+        }
+    }
+    TEST_ASSERT( num_bad == 0 );
+
+    string mesh_bin_stl = veh.ImportFile( out_file, vsp::IMPORT_STL );
+    TEST_ASSERT( mesh_bin_stl.compare( "NONE" ) != 0 );
+    CompareMeshes( veh, mesh_orig, mesh_bin_stl );
+    veh.ClearActiveGeom();
+    veh.AddActiveGeom( mesh_bin_stl );
+    veh.CutActiveGeomVec();
+
+    //==== Binary TRI - Big Endian Fortran Records Bracketed By Matching Byte Counts ====//
+    out_file = "tri_txt_test.tri";
+    veh.WriteTRIFile( out_file, 0 );
+    int num_pnts = 0;
+    int num_tris = 0;
+    FILE* fp = fopen( out_file.c_str(), "r" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        TEST_ASSERT( fscanf( fp, "%d %d", &num_pnts, &num_tris ) == 2 );
+        fclose( fp );
+    }
+    TEST_ASSERT( num_pnts > 0 && num_tris > 0 );
+
+    out_file = "tri_bin_test.tri";
+    veh.m_Cart3DBinary = true;
+    veh.WriteTRIFile( out_file, 0 );
+    veh.m_Cart3DBinary = false;
+
+    vector< unsigned char > bytes;
+    fp = fopen( out_file.c_str(), "rb" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        unsigned char chunk[4096];
+        size_t num;
+        while ( ( num = fread( chunk, 1, sizeof( chunk ), fp ) ) > 0 )
+        {
+            bytes.insert( bytes.end(), chunk, chunk + num );
+        }
+        fclose( fp );
+    }
+
+    int record_size[] = { 2 * 4, 3 * 4 * num_pnts, 3 * 4 * num_tris, 4 * num_tris };
+    size_t pos = 0;
+    bool records_ok = true;
+    for ( int r = 0 ; r < 4 && records_ok ; r++ )
+    {
+        records_ok = pos + record_size[r] + 8 <= bytes.size() &&
+                     ReadBigEndianInt( bytes, pos ) == record_size[r] &&
+                     ReadBigEndianInt( bytes, pos + 4 + record_size[r] ) == record_size[r];
+        if ( records_ok && r == 0 )
+        {
+            TEST_ASSERT( ReadBigEndianInt( bytes, pos + 4 ) == num_pnts );
+            TEST_ASSERT( ReadBigEndianInt( bytes, pos + 8 ) == num_tris );
+        }
+        pos += record_size[r] + 8;
+    }
+    TEST_ASSERT( records_ok );
+    TEST_ASSERT( pos == bytes.size() );
+}
+
+//==== Test MeshGeom And PtCloudGeom XML Round Trip ====//
+void GeomCoreTestSuite::MeshXmlTest()
+{
+    //==== Init Adds The Sets Geoms Are Written By - It Needs The Global Vehicle Built First ====//
+    VehicleMgr.GetVehicle();
+    Vehicle veh;
+    veh.Init();
+    GeomType type;
+    type.m_Type = POD_GEOM_TYPE;
+    type.m_Name = "POD";
+
+    string id0 = veh.AddGeom( type );
+
+    string mesh_id = veh.AddMeshGeom( 0 );
+    TEST_ASSERT( mesh_id.compare( "NONE" ) != 0 );
+    MeshGeom* mesh = ( MeshGeom* )veh.FindGeom( mesh_id );
+    TEST_ASSERT( mesh != NULL );
+    if ( !mesh )
+    {
+        return;
+    }
+    mesh->FlattenTMeshVec();
+
+    //==== Binary Tri_Data Must Reproduce Points And Normals Exactly, Text Tri_List Must Still Load ====//
+    for ( int binary = 1 ; binary >= 0 ; binary-- )
+    {
+        veh.m_BinaryMeshXml = binary;
+
+        xmlNodePtr root = xmlNewNode( NULL, ( const xmlChar * )"Vsp_Geometry" );
+        mesh->EncodeXml( root );
+
+        xmlNodePtr tmesh_node = XmlUtil::GetNode( XmlUtil::GetNode( root, "MeshGeom", 0 ), "TMesh", 0 );
+        TEST_ASSERT( tmesh_node != NULL );
+        if ( tmesh_node )
+        {
+            TEST_ASSERT( ( XmlUtil::GetNode( tmesh_node, "Tri_Data", 0 ) != NULL ) == ( binary == 1 ) );
+            TEST_ASSERT( ( XmlUtil::GetNode( tmesh_node, "Tri_List", 0 ) != NULL ) == ( binary == 0 ) );
+        }
+
+        MeshGeom* decoded = new MeshGeom( &veh );
+        decoded->DecodeXml( root );
+        decoded->FlattenTMeshVec();
+
+        TEST_ASSERT( decoded->m_TMeshVec.size() == mesh->m_TMeshVec.size() );
+        for ( int i = 0 ; i < ( int )mesh->m_TMeshVec.size() && i < ( int )decoded->m_TMeshVec.size() ; i++ )
+        {
+            vector< TTri* > & tvec = mesh->m_TMeshVec[i]->m_TVec;
+            vector< TTri* > & dvec = decoded->m_TMeshVec[i]->m_TVec;
+            TEST_ASSERT( tvec.size() > 0 );
+            TEST_ASSERT( tvec.size() == dvec.size() );
+
+            bool same_bits = true;
+            for ( int t = 0 ; t < ( int )tvec.size() && t < ( int )dvec.size() ; t++ )
+            {
+                if ( binary )
+                {
+                    same_bits = same_bits && SameBits( tvec[t]->m_N0->m_Pnt, dvec[t]->m_N0->m_Pnt ) &&
+                                SameBits( tvec[t]->m_N1->m_Pnt, dvec[t]->m_N1->m_Pnt ) &&
+                                SameBits( tvec[t]->m_N2->m_Pnt, dvec[t]->m_N2->m_Pnt ) &&
+                                SameBits( tvec[t]->m_Norm, dvec[t]->m_Norm );
+                }
+                else
+                {
+                    CompareVec3ds( tvec[t]->m_N0->m_Pnt, dvec[t]->m_N0->m_Pnt );
+                    CompareVec3ds( tvec[t]->m_N1->m_Pnt, dvec[t]->m_N1->m_Pnt );
+                    CompareVec3ds( tvec[t]->m_N2->m_Pnt, dvec[t]->m_N2->m_Pnt );
+                    CompareVec3ds( tvec[t]->m_Norm, dvec[t]->m_Norm, "Norm" );
+                }
+            }
+            TEST_ASSERT( same_bits );
+        }
+
+        delete decoded;
+        xmlFreeNode( root );
+    }
+
+    //==== Point Cloud ====//
+    PtCloudGeom* cloud = new PtCloudGeom( &veh );
+    for ( int i = 0 ; i < 1000 ; i++ )
+    {
+        double t = 0.1 * i;
+        cloud->m_Pts.push_back( vec3d( 1.0 / 3.0 + t, -t * t / 7.0, sin( 17.0 * t ) * 1.0e-9 ) );
+    }
+
+    for ( int binary = 1 ; binary >= 0 ; binary-- )
+    {
+        veh.m_BinaryMeshXml = binary;
+
+        xmlNodePtr root = xmlNewNode( NULL, ( const xmlChar * )"Vsp_Geometry" );
+        cloud->EncodeXml( root );
+
+        xmlNodePtr ptcloud_node = XmlUtil::GetNode( root, "PtCloudGeom", 0 );
+        TEST_ASSERT( ptcloud_node != NULL );
+        if ( ptcloud_node )
+        {
+            TEST_ASSERT( ( XmlUtil::GetNode( ptcloud_node, "Pt_Data", 0 ) != NULL ) == ( binary == 1 ) );
+            TEST_ASSERT( ( XmlUtil::GetNode( ptcloud_node, "Pt_List", 0 ) != NULL ) == ( binary == 0 ) );
+        }
+
+        PtCloudGeom* decoded = new PtCloudGeom( &veh );
+        decoded->DecodeXml( root );
+
+        TEST_ASSERT( decoded->m_Pts.size() == cloud->m_Pts.size() );
+        bool same_bits = true;
+        for ( int i = 0 ; i < ( int )cloud->m_Pts.size() && i < ( int )decoded->m_Pts.size() ; i++ )
+        {
+            if ( binary )
+            {
+                same_bits = same_bits && SameBits( cloud->m_Pts[i], decoded->m_Pts[i] );
+            }
+            else
+            {
+                CompareVec3ds( cloud->m_Pts[i], decoded->m_Pts[i] );
+            }
+        }
+        TEST_ASSERT( same_bits );
+
+        delete decoded;
+        xmlFreeNode( root );
+    }
+
+    delete cloud;
+    ParmMgr.ResetRemapID();
+}
+
 void GeomCoreTestSuite::CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b )
 {
     MeshGeom* mesh_1 = ( MeshGeom* )veh.FindGeom( mesh_a );
@@ -280,3 +557,16 @@ void GeomCoreTestSuite::CompareVec3ds( const vec3d & v1, const vec3d & v2, const
     sprintf( str, "v1[2]: %10.16g v%10.16g %s", v1[2], v2[2], msg );
     TEST_ASSERT_MSG( fabs( v1[2] - v2[2] ) < 1e-5, str );
 }
+
+bool GeomCoreTestSuite::SameBits( const vec3d & v1, const vec3d & v2 )
+{
+    double d1[3] = { v1.x(), v1.y(), v1.z() };
+    double d2[3] = { v2.x(), v2.y(), v2.z() };
+    return memcmp( d1, d2, sizeof( d1 ) ) == 0;
+}
+
+int GeomCoreTestSuite::ReadBigEndianInt( const vector< unsigned char > & bytes, size_t pos )
+{
+    return ( int )( ( ( unsigned int )bytes[pos] << 24 ) | ( ( unsigned int )bytes[pos + 1] << 16 ) |
+                    ( ( unsigned int )bytes[pos + 2] << 8 ) | ( unsigned int )bytes[pos + 3] );
+}
@@ -27,6 +27,8 @@ public:
         TEST_ADD( GeomCoreTestSuite::PodTest )
         TEST_ADD( GeomCoreTestSuite::XmlTest )
         TEST_ADD( GeomCoreTestSuite::MeshIOTest )
+        TEST_ADD( GeomCoreTestSuite::MeshBinIOTest )
+        TEST_ADD( GeomCoreTestSuite::MeshXmlTest )
     }
 
 private:
@@ -36,8 +38,12 @@ private:
     void PodTest();
     void XmlTest();
     void MeshIOTest();
+    void MeshBinIOTest();
+    void MeshXmlTest();
     void CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b );
     void CompareVec3ds( const vec3d & v1, const vec3d & v2, const char * msg = NULL );
+    bool SameBits( const vec3d & v1, const vec3d & v2 );
+    int ReadBigEndianInt( const vector< unsigned char > & bytes, size_t pos );
 
     void WritePnts( std::vector< vec3d > & pnt_vec, std::string file_name );
 
@@ -335,6 +335,10 @@ double PointSimpleSource::GetTargetLen( double base_len, vec3d &  pos )
 void PointSimpleSource::Update( Geom* geomPtr )
 {
     m_Loc = geomPtr->GetUWPt( m_SurfIndx, m_ULoc, m_WLoc );
+
+    m_Box.Reset();
+    m_Box.Update( m_Loc );
+    m_Box.Expand( m_Rad );
 }
 
 void PointSimpleSource::LoadDrawObjs( vector< DrawObj* > & draw_obj_vec )
@@ -763,6 +767,7 @@ void BoxSimpleSource::Highlight( bool flag )
 GridDensity::GridDensity() : ParmContainer()
 {
     m_GroupName = "NONE";
+    m_SourceTreeValid = false;
 }
 
 void GridDensity::InitParms()
@@ -879,7 +884,47 @@ double GridDensity::GetFarRadFrac()
     return radFrac;
 }
 
+void GridDensity::BuildSourceTree()
+{
+    vector< BndBox > box_vec( m_Sources.size() );
+    for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+    {
+        box_vec[i] = m_Sources[i]->GetBBox();
+
+        //==== Pad So Round Off Never Drops A Source At Its Boundary ====//
+        box_vec[i].Expand( 1.0e-6 * box_vec[i].DiagDist() + 1.0e-12 );
+    }
+    m_SourceTree.Build( box_vec );
+    m_SourceTreeValid = true;
+}
+
 double GridDensity::GetTargetLen( vec3d& pos, bool farFlag )
+{
+    vector< int > cand_vec;
+    return GetTargetLen( pos, farFlag, cand_vec );
+}
+
+//==== Batch Query - Points Are Independent ====//
+void GridDensity::GetTargetLen( const vector< vec3d > & pos_vec, vector< double > & len_vec, bool farFlag, int num_threads )
+{
+    int npos = ( int )pos_vec.size();
+    len_vec.resize( npos );
+
+    #pragma omp parallel num_threads( num_threads )
+    {
+        vector< int > cand_vec;
+
+        #pragma omp for
+        for ( int i = 0 ; i < npos ; i++ )
+        {
+            vec3d pos = pos_vec[i];
+            len_vec[i] = GetTargetLen( pos, farFlag, cand_vec );
+        }
+    }
+}
+
+//==== Only Sources Whose Influence Box Holds pos Can Lower The Base Length ====//
+double GridDensity::GetTargetLen( vec3d& pos, bool farFlag, vector< int > & cand_vec )
 {
     double target_len;
     double base_len;
@@ -894,9 +939,28 @@ double GridDensity::GetTargetLen( vec3d& pos, bool farFlag )
     }
     base_len = target_len;
 
-    for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+    if ( !m_SourceTreeValid )
+    {
+        for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+        {
+            double len = m_Sources[i]->GetTargetLen( base_len, pos );
+            if ( len < target_len )
+            {
+                target_len = len;
+            }
+        }
+        return target_len;
+    }
+
+    BndBox pnt_box;
+    pnt_box.Update( pos );
+
+    cand_vec.clear();
+    m_SourceTree.FindOverlap( pnt_box, cand_vec, 0.0 );
+
+    for ( int i = 0 ; i < ( int )cand_vec.size() ; i++ )
     {
-        double len = m_Sources[i]->GetTargetLen( base_len, pos );
+        double len = m_Sources[ cand_vec[i] ]->GetTargetLen( base_len, pos );
         if ( len < target_len )
         {
             target_len = len;
@@ -19,6 +19,7 @@
 #include "Vec2d.h"
 #include "Vec3d.h"
 #include "BndBox.h"
+#include "BndBoxTree.h"
 #include "XmlUtil.h"
 #include "Parm.h"
 #include "ParmContainer.h"
@@ -169,6 +170,12 @@ public:
     virtual void Show( bool flag ) = 0;
     virtual void Highlight( bool flag ) = 0;
 
+    //==== Region Of Influence - GetTargetLen Returns base_len Outside ====//
+    const BndBox & GetBBox() const
+    {
+        return m_Box;
+    }
+
     double m_Len;
     double m_Rad;
 
@@ -351,15 +358,22 @@ public:
     double GetFarRadFrac();
 
     double GetTargetLen( vec3d& pos, bool farFlag = false );
+    void GetTargetLen( const vector< vec3d > & pos_vec, vector< double > & len_vec, bool farFlag, int num_threads );
 
     void ClearSources()
     {
         m_Sources.clear();    //Deleted in Geom
+        m_SourceTree.Clear();
+        m_SourceTreeValid = false;
     }
     void AddSource( BaseSimpleSource* s )
     {
         m_Sources.push_back( s );
+        m_SourceTreeValid = false;
     }
+
+    //==== Index Source Influence Boxes - Call After Sources Are Added or Moved ====//
+    void BuildSourceTree();
     int  GetNumSources()
     {
         return m_Sources.size();
@@ -386,6 +400,11 @@ protected:
     string m_GroupName;
     vector< BaseSimpleSource* > m_Sources;                // Sources + Ref Sources in 3D Space
 
+    double GetTargetLen( vec3d& pos, bool farFlag, vector< int > & cand_vec );
+
+    BndBoxTree m_SourceTree;
+    bool m_SourceTreeValid;
+
 };
 
 class CfdGridDensity : public GridDensity
@@ -22,6 +22,9 @@
 
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "StlFile.h"
+#include "WriteBuffer.h"
+#include "MeshProfile.h"
 
 #include "SubSurfaceMgr.h"
 
@@ -105,9 +108,11 @@ xmlNodePtr MeshGeom::EncodeXml( xmlNodePtr & node )
     Geom::EncodeXml( node );
     xmlNodePtr mesh_node = xmlNewChild( node, NULL, BAD_CAST "MeshGeom", NULL );
     XmlUtil::AddIntNode( mesh_node, "Num_Meshes", ( int )m_TMeshVec.size() );
+
+    bool binary_flag = m_Vehicle && m_Vehicle->m_BinaryMeshXml();
     for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        m_TMeshVec[i]->EncodeXml( mesh_node );
+        m_TMeshVec[i]->EncodeXml( mesh_node, binary_flag );
     }
 
     return mesh_node;
@@ -253,166 +258,43 @@ void MeshGeom::AddTri( TMesh* tMesh, vec3d & p0, vec3d & p1, vec3d & p2 )
 
 int MeshGeom::ReadSTL( const char* file_name )
 {
-    FILE* file_id = fopen( file_name, "r" );
-
-    char str[256];
-    float nx, ny, nz;
-    float v0[3];
-    float v1[3];
-    float v2[3];
-    TTri*  tPtr;
-    TMesh*  tMesh = new TMesh();
-
-    if ( file_id )
+    //==== Map File, Parse Facets and Weld Identical Vertices ====//
+    StlFile stl;
+    if ( !stl.Read( string( file_name ) ) || stl.GetNumFacets() == 0 )
     {
-        //==== Cheesy ASCII/Binary Test ====//
-        int binaryFlag = 0;
-        while ( fgets( str, 255, file_id ) )
-        {
-            for ( int i = 0 ; i < ( int )strlen( str ) ; i++ )
-            {
-                if ( ( unsigned char )str[i] > 127 )
-                {
-                    binaryFlag = 1;
-                    break;
-                }
-            }
-        }
-
-        rewind( file_id );
-
-        if ( !binaryFlag )
-        {
-            fgets( str, 255, file_id );
-
-            int stopFlag = 0;
-
-            while ( !stopFlag )
-            {
-                if ( EOF == fscanf( file_id, "%*s %*s %f %f %f\n", &nx, &ny, &nz ) )
-                {
-                    break;
-                }
-
-                if ( EOF == fscanf( file_id, "%*s %*s" ) )
-                {
-                    break;
-                }
-
-                if ( EOF == fscanf( file_id, "%*s %f %f %f\n", &v0[0], &v0[1], &v0[2] ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s %f %f %f\n", &v1[0], &v1[1], &v1[2] ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s %f %f %f\n", &v2[0], &v2[1], &v2[2] ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s" ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s" ) )
-                {
-                    break;
-                }
-
-                //==== Add Valid Facet ====//
-                tPtr = new TTri();
-                tPtr->m_InteriorFlag = 0;
-                tPtr->m_Norm = vec3d( nx, ny, nz );
-                tMesh->m_TVec.push_back( tPtr );
-
-                //==== Put Nodes Into Tri ====//
-                tPtr->m_N0 = new TNode();
-                tPtr->m_N1 = new TNode();
-                tPtr->m_N2 = new TNode();
-                tPtr->m_N0->m_Pnt = vec3d( v0[0], v0[1], v0[2] );
-                tPtr->m_N1->m_Pnt = vec3d( v1[0], v1[1], v1[2] );
-                tPtr->m_N2->m_Pnt = vec3d( v2[0], v2[1], v2[2] );
-                tMesh->m_NVec.push_back( tPtr->m_N0 );
-                tMesh->m_NVec.push_back( tPtr->m_N1 );
-                tMesh->m_NVec.push_back( tPtr->m_N2 );
-
-                fpos_t pos;
-                fgetpos( file_id, &pos );
-
-                if ( EOF == fscanf( file_id, "%s %*s\n", str ) )
-                {
-                    break;
-                }
-
-                if ( strcmp( str, "endsolid" ) == 0 )
-                {
-                    fgets( str, 255, file_id );
-                    if ( feof( file_id ) )
-                    {
-                        break;
-                    }
-                }
-                else
-                {
-                    fsetpos( file_id, &pos );
-                }
-            }
-        }
-        else
-        {
-            fclose( file_id );
-            file_id = fopen( file_name, "rb" );         // Reopen as Binary
-
-            //==== Header ====//
-            fread( str, sizeof( char ), 80, file_id );
-
-            int numFacet = ReadBinInt( file_id );
-
-            for ( int i = 0 ; i < numFacet ; i++ )
-            {
-                nx = ReadBinFloat( file_id );
-                ny = ReadBinFloat( file_id );
-                nz = ReadBinFloat( file_id );
-
-                v0[0] = ReadBinFloat( file_id );
-                v0[1] = ReadBinFloat( file_id );
-                v0[2] = ReadBinFloat( file_id );
-                v1[0] = ReadBinFloat( file_id );
-                v1[1] = ReadBinFloat( file_id );
-                v1[2] = ReadBinFloat( file_id );
-                v2[0] = ReadBinFloat( file_id );
-                v2[1] = ReadBinFloat( file_id );
-                v2[2] = ReadBinFloat( file_id );
-
-                //==== Padding ====//
-                fgetc( file_id );
-                fgetc( file_id );
+        return 0;
+    }
+    stl.Weld();
 
-                //==== Add Valid Facet ====//
-                tPtr = new TTri();
-                tPtr->m_InteriorFlag = 0;
-                tPtr->m_Norm = vec3d( nx, ny, nz );
-                tMesh->m_TVec.push_back( tPtr );
+    int num_node = stl.GetNumNodes();
+    int num_tri = stl.GetNumFacets();
 
-                //==== Put Nodes Into Tri ====//
-                tPtr->m_N0 = new TNode();
-                tPtr->m_N1 = new TNode();;
-                tPtr->m_N2 = new TNode();
-                tPtr->m_N0->m_Pnt = vec3d( v0[0], v0[1], v0[2] );
-                tPtr->m_N1->m_Pnt = vec3d( v1[0], v1[1], v1[2] );
-                tPtr->m_N2->m_Pnt = vec3d( v2[0], v2[1], v2[2] );
+    TMesh*  tMesh = new TMesh();
+    tMesh->m_NVec.resize( num_node );
+    tMesh->m_TVec.resize( num_tri );
 
-            }
-        }
-        fclose( file_id );
+    //==== Arena Keeps One Block List Per Thread ====//
+    #pragma omp parallel for
+    for ( int i = 0 ; i < num_node ; i++ )
+    {
+        TNode* n = new ( &tMesh->m_Arena ) TNode();
+        n->m_Pnt = vec3d( stl.m_NodePntVec[ 3 * i ], stl.m_NodePntVec[ 3 * i + 1 ], stl.m_NodePntVec[ 3 * i + 2 ] );
+        tMesh->m_NVec[i] = n;
     }
+    vector< float >().swap( stl.m_NodePntVec );
 
-
-    if ( tMesh->m_TVec.size() == 0 )
+    #pragma omp parallel for
+    for ( int i = 0 ; i < num_tri ; i++ )
     {
-        delete tMesh;
-        return 0;
+        TTri* tPtr = new ( &tMesh->m_Arena ) TTri();
+        tPtr->m_InteriorFlag = 0;
+        tPtr->m_Norm = vec3d( stl.m_NormVec[ 3 * i ], stl.m_NormVec[ 3 * i + 1 ], stl.m_NormVec[ 3 * i + 2 ] );
+
+        //==== Put Nodes Into Tri ====//
+        tPtr->m_N0 = tMesh->m_NVec[ stl.m_TriNodeVec[ 3 * i ] ];
+        tPtr->m_N1 = tMesh->m_NVec[ stl.m_TriNodeVec[ 3 * i + 1 ] ];
+        tPtr->m_N2 = tMesh->m_NVec[ stl.m_TriNodeVec[ 3 * i + 2 ] ];
+        tMesh->m_TVec[i] = tPtr;
     }
 
     m_TMeshVec.push_back( tMesh );
@@ -484,7 +366,7 @@ void MeshGeom::WriteStl( FILE* file_id )
 void MeshGeom::WriteStl( FILE* file_id, int tag )
 {
     //==== Write Out Tris ====//
-    for ( int i = 0 ; i < ( int )m_IndexedTriVec.size() ; i++ )
+    WriteBuffer::WriteParallel( file_id, ( int )m_IndexedTriVec.size(), [&]( WriteBuffer & buf, int i )
     {
         TTri* ttri = m_IndexedTriVec[i];
 
@@ -500,17 +382,26 @@ void MeshGeom::WriteStl( FILE* file_id, int tag )
             vec3d norm = cross( v10, v20 );
             norm.normalize();
 
-            fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-            fprintf( file_id, "   outer loop\n" );
+            TMesh::WriteSTLFacet( buf, norm, p0, p1, p2 );
+        }
+    } );
+}
 
-            fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0.x(), p0.y(), p0.z() );
-            fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p1.x(), p1.y(), p1.z() );
-            fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2.x(), p2.y(), p2.z() );
+//==== Write Binary STL Facets - Returns Number Written ====//
+int MeshGeom::WriteBinStl( FILE* file_id )
+{
+    int num = 0;
 
-            fprintf( file_id, "   endloop\n" );
-            fprintf( file_id, " endfacet\n" );
-        }
+    for ( int m = 0 ; m < ( int )m_TMeshVec.size() ; m++ )
+    {
+        num += m_TMeshVec[m]->WriteBinSTLTris( file_id, GetTotalTransMat() );
     }
+
+    for ( int m = 0 ; m < ( int )m_SliceVec.size() ; m++ )
+    {
+        num += m_SliceVec[m]->WriteBinSTLTris( file_id, GetTotalTransMat() );
+    }
+    return num;
 }
 
 int MeshGeom::ReadNascart( const char* file_name )
@@ -772,38 +663,64 @@ void MeshGeom::BuildIndexedMesh( int partOffset )
     Update();
 }
 
+//==== Same Text As fprintf With "%16.10g %16.10g %16.10g\n" ====//
+static void AppendPntLine( WriteBuffer & buf, double x, double y, double z )
+{
+    buf.AppendGen( x, 16, 10 );
+    buf.Append( " ", 1 );
+    buf.AppendGen( y, 16, 10 );
+    buf.Append( " ", 1 );
+    buf.AppendGen( z, 16, 10 );
+    buf.Append( "\n", 1 );
+}
+
 void MeshGeom::WriteNascartPnts( FILE* fp )
 {
-    vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
     //==== Write Out Nodes ====//
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    WriteBuffer::WriteParallel( fp, ( int )m_IndexedNodeVec.size(), [&]( WriteBuffer & buf, int i )
     {
         TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
         if( tnode )
         {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.z(), -v.y() );
+            vec3d v = XFormMat.xform( tnode->m_Pnt );
+            AppendPntLine( buf, v.x(), v.z(), -v.y() );
         }
-    }
+    } );
 }
 
 void MeshGeom::WriteCart3DPnts( FILE* fp )
 {
     //==== Write Out Nodes ====//
-    vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    WriteBuffer::WriteParallel( fp, ( int )m_IndexedNodeVec.size(), [&]( WriteBuffer & buf, int i )
     {
         TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
         if( tnode )
         {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
+            vec3d v = XFormMat.xform( tnode->m_Pnt );
+            AppendPntLine( buf, v.x(), v.y(), v.z() );
         }
-    }
+    } );
+}
+
+//==== Big Endian Single Precision Coords - Returns Bytes Written ====//
+int MeshGeom::WriteBinCart3DPnts( FILE* fp )
+{
+    Matrix4d XFormMat = GetTotalTransMat();
+    return ( int )WriteBuffer::WriteParallel( fp, ( int )m_IndexedNodeVec.size(), [&]( WriteBuffer & buf, int i )
+    {
+        TNode* tnode = m_IndexedNodeVec[i];
+        if( tnode )
+        {
+            vec3d v = XFormMat.xform( tnode->m_Pnt );
+            buf.AppendBinFloat( ( float )v.x(), true );
+            buf.AppendBinFloat( ( float )v.y(), true );
+            buf.AppendBinFloat( ( float )v.z(), true );
+        }
+    } );
 }
 
 int MeshGeom::WriteGMshNodes( FILE* fp, int node_offset )
@@ -827,15 +744,21 @@ int MeshGeom::WriteGMshNodes( FILE* fp, int node_offset )
 int MeshGeom::WriteNascartTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    WriteBuffer::WriteParallel( fp, ( int )m_IndexedTriVec.size(), [&]( WriteBuffer & buf, int t )
     {
         TTri* ttri = m_IndexedTriVec[t];
         if( ttri )
         {
-            fprintf( fp, "%d %d %d %d.0\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N2->m_ID + 1 + off,
-                     ttri->m_N1->m_ID + 1 + off, SubSurfaceMgr.GetTag( ttri->m_Tags ) );
+            buf.AppendInt( ttri->m_N0->m_ID + 1 + off );
+            buf.Append( " ", 1 );
+            buf.AppendInt( ttri->m_N2->m_ID + 1 + off );
+            buf.Append( " ", 1 );
+            buf.AppendInt( ttri->m_N1->m_ID + 1 + off );
+            buf.Append( " ", 1 );
+            buf.AppendInt( SubSurfaceMgr.GetTag( ttri->m_Tags ) );
+            buf.Append( ".0\n", 3 );
         }
-    }
+    } );
 
     return ( off + m_IndexedNodeVec.size() );
 }
@@ -843,14 +766,35 @@ int MeshGeom::WriteNascartTris( FILE* fp, int off )
 int MeshGeom::WriteCart3DTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    WriteBuffer::WriteParallel( fp, ( int )m_IndexedTriVec.size(), [&]( WriteBuffer & buf, int t )
     {
         TTri* ttri = m_IndexedTriVec[t];
         if( ttri )
         {
-            fprintf( fp, "%d %d %d\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N1->m_ID + 1 + off, ttri->m_N2->m_ID + 1 + off );
+            buf.AppendInt( ttri->m_N0->m_ID + 1 + off );
+            buf.Append( " ", 1 );
+            buf.AppendInt( ttri->m_N1->m_ID + 1 + off );
+            buf.Append( " ", 1 );
+            buf.AppendInt( ttri->m_N2->m_ID + 1 + off );
+            buf.Append( "\n", 1 );
         }
-    }
+    } );
+
+    return ( off + m_IndexedNodeVec.size() );
+}
+
+int MeshGeom::WriteBinCart3DTris( FILE* fp, int off )
+{
+    WriteBuffer::WriteParallel( fp, ( int )m_IndexedTriVec.size(), [&]( WriteBuffer & buf, int t )
+    {
+        TTri* ttri = m_IndexedTriVec[t];
+        if( ttri )
+        {
+            buf.AppendBinInt( ttri->m_N0->m_ID + 1 + off, true );
+            buf.AppendBinInt( ttri->m_N1->m_ID + 1 + off, true );
+            buf.AppendBinInt( ttri->m_N2->m_ID + 1 + off, true );
+        }
+    } );
 
     return ( off + m_IndexedNodeVec.size() );
 }
@@ -883,13 +827,20 @@ int MeshGeom::WriteNascartParts( FILE* fp, int off )
 int MeshGeom::WriteCart3DParts( FILE* fp  )
 {
     //==== Write Component IDs for each Tri =====//
-    int tag;
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    WriteBuffer::WriteParallel( fp, ( int )m_IndexedTriVec.size(), [&]( WriteBuffer & buf, int t )
     {
-        tag = SubSurfaceMgr.GetTag( m_IndexedTriVec[t]->m_Tags );
+        buf.AppendInt( SubSurfaceMgr.GetTag( m_IndexedTriVec[t]->m_Tags ) );
+        buf.Append( " \n", 2 );
+    } );
+    return 0;
+}
 
-        fprintf( fp, "%d \n",  tag );
-    }
+int MeshGeom::WriteBinCart3DParts( FILE* fp  )
+{
+    WriteBuffer::WriteParallel( fp, ( int )m_IndexedTriVec.size(), [&]( WriteBuffer & buf, int t )
+    {
+        buf.AppendBinInt( SubSurfaceMgr.GetTag( m_IndexedTriVec[t]->m_Tags ), true );
+    } );
     return 0;
 }
 
@@ -1336,6 +1287,33 @@ void MeshGeom::CreateGeomResults( Results* res )
     }
 }
 
+//==== Node, Edge and Tri Allocations Since TMeshArenaObj::ResetAllocCounts, Plus Arena Memory Still Held ====//
+void MeshGeom::AddTMeshAllocResults( Results* res )
+{
+    long long num_arena_alloc = TMeshArenaObj::GetNumArenaAlloc();
+    long long num_arena_reuse = TMeshArenaObj::GetNumArenaReuse();
+    long long num_arena_blocks = TMeshArenaObj::GetNumArenaBlocks();
+    size_t arena_mem = 0;
+    size_t arena_free = 0;
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        const TMeshArena & arena = m_TMeshVec[i]->m_Arena;
+        num_arena_alloc += arena.GetNumAlloc();
+        num_arena_reuse += arena.GetNumReuse();
+        num_arena_blocks += arena.GetNumBlocks();
+        arena_mem += arena.GetMemorySize();
+        arena_free += arena.GetFreeSize();
+    }
+
+    res->Add( NameValData( "Num_TMesh_Heap_Allocs", ( int )TMeshArenaObj::GetNumHeapAlloc() ) );
+    res->Add( NameValData( "Num_TMesh_Arena_Allocs", ( int )num_arena_alloc ) );
+    res->Add( NameValData( "Num_TMesh_Arena_Reuses", ( int )num_arena_reuse ) );
+    res->Add( NameValData( "Num_TMesh_Arena_Blocks", ( int )num_arena_blocks ) );
+    res->Add( NameValData( "TMesh_Arena_Memory_KB", arena_mem / 1024.0 ) );
+    res->Add( NameValData( "TMesh_Arena_Free_KB", arena_free / 1024.0 ) );
+    res->Add( NameValData( "Peak_RSS_KB", MeshProfile::GetPeakRSS() ) );
+}
+
 void MeshGeom::CreatePtCloudGeom()
 {
     BuildIndexedMesh( 0 );
@@ -1812,6 +1790,8 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
     res->Add( NameValData( "Num_Open_Meshes_Removed", info.m_NumOpenMeshedDeleted ) );
     res->Add( NameValData( "Num_Open_Meshes_Merged", info.m_NumOpenMeshesMerged ) );
 
+    AddTMeshAllocResults( res );
+
     string txtfn = m_Vehicle->getExportFileName( vsp::COMP_GEOM_TXT_TYPE );
     res->WriteCompGeomTxtFile( txtfn );
 
@@ -2015,6 +1995,67 @@ void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
 }
 
 //==== Call After BndBoxes Have Been Create But Before Intersect ====//
+//==== Call After Component BndBoxes Are Loaded - Slices Are The Last x_vec.size() In m_SliceVec ====//
+void MeshGeom::SweepSlices( const vector< double > & x_vec, bool mass_flag )
+{
+    int i, s;
+    int nslice = ( int )x_vec.size();
+    int first = ( int )m_SliceVec.size() - nslice;
+
+    //==== Sort Slice Planes Once ====//
+    vector< pair< double, int > > plane_vec( nslice );
+    for ( s = 0 ; s < nslice ; s++ )
+    {
+        plane_vec[s] = pair< double, int >( x_vec[s], s );
+    }
+    sort( plane_vec.begin(), plane_vec.end() );
+
+    //==== Sweep Each Component Tri's X Extent Across The Planes It Crosses ====//
+    vector< vector< TTri* > > slice_tri_vec( nslice );
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        for ( int t = 0 ; t < ( int )m_TMeshVec[i]->m_TVec.size() ; t++ )
+        {
+            TTri* tri = m_TMeshVec[i]->m_TVec[t];
+            double x0 = tri->m_N0->m_Pnt.x();
+            double x1 = tri->m_N1->m_Pnt.x();
+            double x2 = tri->m_N2->m_Pnt.x();
+            double tmin = min( x0, min( x1, x2 ) ) - 1.0e-12;
+            double tmax = max( x0, max( x1, x2 ) ) + 1.0e-12;
+
+            vector< pair< double, int > >::iterator it;
+            it = lower_bound( plane_vec.begin(), plane_vec.end(), pair< double, int >( tmin, -1 ) );
+            for ( ; it != plane_vec.end() && it->first <= tmax ; ++it )
+            {
+                slice_tri_vec[ it->second ].push_back( tri );
+            }
+        }
+    }
+
+    //==== Slices Only Add Edges To Their Own Tris So Each Is Independent ====//
+#pragma omp parallel for schedule( dynamic, 1 )
+    for ( s = 0 ; s < nslice ; s++ )
+    {
+        TMesh* tm = m_SliceVec[ first + s ];
+        tm->LoadBndBox();
+        tm->m_TBox.IntersectTris( slice_tri_vec[s] );
+        vector< TTri* >().swap( slice_tri_vec[s] );
+
+        //==== Split Intersected Tri in Mesh ====//
+        tm->Split();
+
+        //==== Determine Which Triangle Are Interior/Exterior ====//
+        if ( mass_flag )
+        {
+            tm->MassDeterIntExt( m_TMeshVec );
+        }
+        else
+        {
+            tm->DeterIntExt( m_TMeshVec );
+        }
+    }
+}
+
 void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
                           bool autoBounds, double start, double end )
 {
@@ -2158,12 +2199,14 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
 
     vec3d norm( 1, 0, 0 );
 
+    vector< double > x_vec;
     for ( s = 0 ; s < numSlices ; s++ )
     {
         TMesh* tm = new TMesh();
         m_SliceVec.push_back( tm );
 
         double x = xMin + ( ( double )s / ( double )( numSlices - 1 ) ) * ( xMax - xMin );
+        x_vec.push_back( x );
 
         double ydel = 1.02 * ( m_BBox.GetMax( 1 ) - m_BBox.GetMin( 1 ) );
         double ys   = m_BBox.GetMin( 1 ) - 0.01 * ydel;
@@ -2194,35 +2237,12 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
         }
     }
 
-    //==== Load Bnding Box ====//
+    //==== Intersect, Split and Classify Slices ====//
+    SweepSlices( x_vec, false );
+
     for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
     {
         TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
 
         //==== Flip Int/Ext Flags ====//
         for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
@@ -2708,30 +2728,44 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         tm->AddTri( gp[2], gp[0], gp[1], gpnorm );
     }
 
-    //==== Load Bnding Box ====//
+    //==== Clear Component Intersection Edges - Component Meshes Are Read Only While Slicing ====//
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        for ( int j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
+        {
+            TTri* tri = m_TMeshVec[i]->m_TVec[j];
+            for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
+            {
+                delete tri->m_ISectEdgeVec[e]->m_N0;
+                delete tri->m_ISectEdgeVec[e]->m_N1;
+                delete tri->m_ISectEdgeVec[e];
+            }
+            tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
+        }
+    }
+
+    //==== Each Slice Only Adds Edges To Its Own Tris So Rotations Are Independent ====//
+#pragma omp parallel for schedule( dynamic, 1 )
     for ( int islice = 0 ; islice < ( int )m_SliceVec.size() ; islice++ )
     {
         TMesh* tm = m_SliceVec[islice];
         tm->LoadBndBox();
 
-        //==== Intersect All Mesh Geoms ====//
+        //==== Gather Component Tris Near Slice Plane From Shared Bnd Boxes ====//
+        TTri* ptri = tm->m_TVec[0];
+        vec3d org = ptri->m_N0->m_Pnt;
+        vec3d norm = cross( ptri->m_N1->m_Pnt - org, ptri->m_N2->m_Pnt - org );
+        norm.normalize();
+
+        vector< TTri* > plane_tri_vec;
         for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
         {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( int j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
+            m_TMeshVec[i]->m_TBox.PlaneTris( org, norm, plane_tri_vec );
         }
 
+        //==== Intersect All Mesh Geoms ====//
+        tm->m_TBox.IntersectTris( plane_tri_vec );
+
         //==== Split Intersected Tri in Mesh ====//
         tm->Split();
 
@@ -2773,6 +2807,7 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
     WaveDragMgr.m_ExitArea = exA;
 
 
+#pragma omp parallel for schedule( dynamic, 1 )
     for ( int islice = 0 ; islice < numSlices ; islice++ )
     {
         for ( int itheta = 0; itheta < coneSections; itheta++ )
@@ -2937,12 +2972,14 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         numSlices = 3;
     }
 
+    vector< double > x_vec;
     for ( s = 0 ; s < numSlices ; s++ )
     {
         TMesh* tm = new TMesh();
         m_SliceVec.push_back( tm );
 
         double x = xMin + ( double )s * sliceW + 0.5 * sliceW;
+        x_vec.push_back( x );
 
         double ydel = 1.02 * ( m_BBox.GetMax( 1 ) - m_BBox.GetMin( 1 ) );
         double ys   = m_BBox.GetMin( 1 ) - 0.01 * ydel;
@@ -2965,37 +3002,8 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         }
     }
 
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->MassDeterIntExt( m_TMeshVec );
-
-    }
+    //==== Intersect, Split and Classify Slices ====//
+    SweepSlices( x_vec, true );
     /**********
         //==== Delete Mesh Geometry ====//
         for ( i = 0 ; i < (int)tMeshVec.size() ; i++ )
@@ -3319,6 +3327,8 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     }
     m_TMeshVec = newTMeshVec;
 
+    AddTMeshAllocResults( res );
+
 //  res->WriteCSVFile("junk.txt");
 
     if( writefile )
@@ -3364,12 +3374,14 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
 
 
     //==== Build Slice Mesh Object =====//
+    vector< double > x_vec;
     for ( s = 0 ; s < numSlices ; s++ )
     {
         TMesh* tm = new TMesh();
         m_SliceVec.push_back( tm );
 
         double x = xMin + ( double )s * sliceW + 0.5 * sliceW;
+        x_vec.push_back( x );
 
         double ydel = 1.02 * ( m_BBox.GetMax( 1 ) - m_BBox.GetMin( 1 ) );
         double ys   = m_BBox.GetMin( 1 ) - 0.01 * ydel;
@@ -3392,36 +3404,8 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
         }
     }
 
-    //==== Load Bounding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->MassDeterIntExt( m_TMeshVec );
-    }
+    //==== Intersect, Split and Classify Slices ====//
+    SweepSlices( x_vec, true );
 
 
     //==== Intersect All Mesh Geoms ====//
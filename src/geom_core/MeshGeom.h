@@ -109,6 +109,7 @@ public:
     virtual int   ReadBinInt  ( FILE* fptr );
     virtual void WriteStl( FILE* pov_file );
     virtual void WriteStl( FILE* stl_file, int tag );
+    virtual int  WriteBinStl( FILE* stl_file );
 
     virtual void BuildIndexedMesh( int partOffset );
     virtual int  GetNumIndexedPnts()
@@ -126,15 +127,19 @@ public:
 
     virtual void WriteNascartPnts( FILE* file_id );
     virtual void WriteCart3DPnts( FILE* file_id );
+    virtual int  WriteBinCart3DPnts( FILE* file_id );
     virtual int  WriteGMshNodes( FILE* file_id, int node_offset );
     virtual int  WriteNascartTris( FILE* file_id, int offset );
     virtual int  WriteCart3DTris( FILE* file_id, int offset );
+    virtual int  WriteBinCart3DTris( FILE* file_id, int offset );
     virtual int  WriteGMshTris( FILE* file_id, int node_offset, int tri_offset );
     virtual int  WriteNascartParts( FILE* file_id, int offset );
     virtual int  WriteCart3DParts( FILE* file_id );
+    virtual int  WriteBinCart3DParts( FILE* file_id );
     virtual void WritePovRay( FILE* fid, int comp_num );
     virtual void WriteX3D( xmlNodePtr node );
     virtual void CreateGeomResults( Results* res );
+    virtual void AddTMeshAllocResults( Results* res );
 
     virtual void CreatePtCloudGeom();
 
@@ -146,6 +151,8 @@ public:
     virtual void MassSliceX( int numSlice, bool writefile = true );
     virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom );
     virtual void AreaSlice( int numSlices, vec3d norm, bool autoBounds, double start = 0, double end = 0 );
+    //==== Intersect, Split and Classify m_SliceVec[s] Lying In Plane x = x_vec[s] ====//
+    virtual void SweepSlices( const vector< double > & x_vec, bool mass_flag );
 
     virtual void WaveStartEnd( const double &sliceAngle, const vec3d &center );
     virtual void WaveDragSlice( int numSlices, double sliceAngle, int coneSections,
@@ -135,6 +135,19 @@ ParmContainer* ParmMgrSingleton::FindParmContainer( const string & id )
 }
 
 
+//==== Find Parms Whose Value Was Set After change_cnt ====//
+void ParmMgrSingleton::FindChangedParms( int change_cnt, vector< Parm* > & parm_vec )
+{
+    unordered_map< string, Parm* >::iterator iter;
+    for ( iter = m_ParmMap.begin() ; iter != m_ParmMap.end() ; ++iter )
+    {
+        if ( iter->second->GetChangeCnt() > change_cnt )
+        {
+            parm_vec.push_back( iter->second );
+        }
+    }
+}
+
 //==== Add Parm To Undo Stack ====//
 void ParmMgrSingleton::AddToUndoStack( Parm* parm_ptr, bool drag_flag )
 {
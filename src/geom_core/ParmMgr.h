@@ -20,10 +20,12 @@
 #include <map>
 #include <unordered_map>
 #include <stack>
+#include <vector>
 
 using std::string;
 using std::unordered_map;
 using std::unordered_multimap;
+using std::vector;
 
 //==== Parm Manager ====//
 class ParmMgrSingleton
@@ -78,6 +80,10 @@ public:
     Parm* GetActiveParm()                   { return FindParm( m_ActiveParmID ); }
     int GetNumParmChanges()                 { return m_NumParmChanges; }
     int GetChangeCnt()                      { m_ChangeCnt++; return m_ChangeCnt; }
+    int GetLastChangeCnt()                  { return m_ChangeCnt; }
+
+    //==== Parms Whose Value Was Set After change_cnt ====//
+    void FindChangedParms( int change_cnt, vector< Parm* > & parm_vec );
 
     Parm* CreateParm( int type );
 
@@ -9,6 +9,9 @@
 #include "PntNodeMerge.h"
 #include "Vehicle.h"
 #include "FitModelMgr.h"
+#include "CompressUtil.h"
+
+#include <climits>
 
 //==== Constructor ====//
 PtCloudGeom::PtCloudGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
@@ -251,15 +254,28 @@ xmlNodePtr PtCloudGeom::EncodeXml( xmlNodePtr & node )
     // required too much memory to read in.
     // XmlUtil::AddVectorVec3dNode( ptcloud_node, "Points" , m_Pts );
 
-    xmlNodePtr pt_list_node = xmlNewChild( ptcloud_node, NULL, BAD_CAST "Pt_List", NULL );
-    for ( int i = 0 ; i < ( int ) m_Pts.size() ; i++ )
+    if ( m_Vehicle && m_Vehicle->m_BinaryMeshXml() )
     {
-        XmlUtil::AddVec3dNode( pt_list_node, "Pt", m_Pts[i] );
+        EncodePtData( ptcloud_node );
+    }
+    else
+    {
+        EncodePtList( ptcloud_node );
     }
 
     return ptcloud_node;
 }
 
+xmlNodePtr PtCloudGeom::EncodePtList( xmlNodePtr & node )
+{
+    xmlNodePtr pt_list_node = xmlNewChild( node, NULL, BAD_CAST "Pt_List", NULL );
+    for ( int i = 0 ; i < ( int ) m_Pts.size() ; i++ )
+    {
+        XmlUtil::AddVec3dNode( pt_list_node, "Pt", m_Pts[i] );
+    }
+    return pt_list_node;
+}
+
 //==== Decode XML ====//
 xmlNodePtr PtCloudGeom::DecodeXml( xmlNodePtr & node )
 {
@@ -271,6 +287,13 @@ xmlNodePtr PtCloudGeom::DecodeXml( xmlNodePtr & node )
         // Read in old encoding if it exists.
         m_Pts = XmlUtil::ExtractVectorVec3dNode( ptcloud_node, "Points" );
 
+        // Read in binary encoding if it exists.
+        xmlNodePtr pt_data_node = XmlUtil::GetNode( ptcloud_node, "Pt_Data", 0 );
+        if ( pt_data_node )
+        {
+            DecodePtData( pt_data_node );
+        }
+
         // Read in new encoding if they exist.
         xmlNodePtr pt_list_node = XmlUtil::GetNode( ptcloud_node, "Pt_List", 0 );
         if ( pt_list_node )
@@ -296,6 +319,72 @@ xmlNodePtr PtCloudGeom::DecodeXml( xmlNodePtr & node )
     return ptcloud_node;
 }
 
+//==== Points As Shuffled Doubles In One Compressed Blob ====//
+xmlNodePtr PtCloudGeom::EncodePtData( xmlNodePtr & node )
+{
+    //==== Blob Sizes Are Stored As int ====//
+    if ( m_Pts.size() > INT_MAX / ( 3 * sizeof( double ) ) )
+    {
+        return EncodePtList( node );
+    }
+
+    int num_pts = ( int )m_Pts.size();
+
+    vector< double > dvec( 3 * num_pts );
+    for ( int i = 0 ; i < num_pts ; i++ )
+    {
+        dvec[ 3 * i ] = m_Pts[i].x();
+        dvec[ 3 * i + 1 ] = m_Pts[i].y();
+        dvec[ 3 * i + 2 ] = m_Pts[i].z();
+    }
+
+    vector< unsigned char > data( dvec.size() * sizeof( double ) );
+    if ( !dvec.empty() )
+    {
+        ShuffleBytes( ( const unsigned char* )&dvec[0], dvec.size(), sizeof( double ), data.data() );
+    }
+
+    xmlNodePtr pt_data_node = XmlUtil::AddBlobNode( node, "Pt_Data", data );
+    XmlUtil::SetIntProp( pt_data_node, "Version", PT_DATA_VERSION );
+    XmlUtil::SetIntProp( pt_data_node, "Num_Pts", num_pts );
+
+    return pt_data_node;
+}
+
+//==== Appends To m_Pts - False If Version Is Unknown Or Data Is Corrupt ====//
+bool PtCloudGeom::DecodePtData( xmlNodePtr & node )
+{
+    int version = XmlUtil::FindIntProp( node, "Version", 0 );
+    if ( version != PT_DATA_VERSION )
+    {
+        fprintf( stderr, "PtCloudGeom Pt_Data version %d not supported\n", version );
+        return false;
+    }
+
+    int num_pts = XmlUtil::FindIntProp( node, "Num_Pts", -1 );
+
+    vector< unsigned char > data;
+    if ( num_pts < 0 || !XmlUtil::ExtractBlobNode( node, data ) || data.size() != 3 * ( size_t )num_pts * sizeof( double ) )
+    {
+        fprintf( stderr, "PtCloudGeom Pt_Data is corrupt\n" );
+        return false;
+    }
+
+    vector< double > dvec( 3 * num_pts );
+    if ( !dvec.empty() )
+    {
+        UnshuffleBytes( data.data(), dvec.size(), sizeof( double ), ( unsigned char* )&dvec[0] );
+    }
+
+    m_Pts.reserve( m_Pts.size() + num_pts );
+    for ( int i = 0 ; i < num_pts ; i++ )
+    {
+        m_Pts.push_back( vec3d( dvec[ 3 * i ], dvec[ 3 * i + 1 ], dvec[ 3 * i + 2 ] ) );
+    }
+
+    return true;
+}
+
 void PtCloudGeom::SelectPoint( int index )
 {
     m_Selected[ m_ShownIndx[ index ] ] = true;
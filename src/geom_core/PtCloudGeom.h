@@ -39,6 +39,12 @@ public:
 
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual xmlNodePtr DecodeXml( xmlNodePtr & node );
+    virtual xmlNodePtr EncodePtList( xmlNodePtr & node );
+    virtual xmlNodePtr EncodePtData( xmlNodePtr & node );
+    virtual bool DecodePtData( xmlNodePtr & node );
+
+    //==== Layout Of Pt_Data Blob Written By EncodePtData ====//
+    enum { PT_DATA_VERSION = 1 };
 
     void SelectPoint( int index );
     void UnSelectLastSel();
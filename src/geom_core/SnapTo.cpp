@@ -19,10 +19,14 @@ SnapTo::SnapTo() : ParmContainer()
     m_CollisionErrorFlag = vsp::COLLISION_OK;
     m_CollisionMinDist = 0.0;
 
+    m_OtherChangeCnt = 0;
+    m_OtherNumParmChanges = 0;
+    m_OtherReuseFlag = false;
 }
 
 SnapTo::~SnapTo()
 {
+    ClearOtherTMeshVec();
 }
 
 //==== Parm Changed ====//
@@ -59,24 +63,14 @@ void SnapTo::PreventCollision( const string & geom_id, const string & parm_id )
 //===== Vectors of TMeshs with Bounding Boxes Already Set Up ====//
 bool SnapTo::CheckIntersect( Geom* geom_ptr, const vector<TMesh*> & other_tmesh_vec )
 {
-    bool intsect_flag = false;
-
     vector< TMesh* > tmesh_vec = geom_ptr->CreateTMeshVec();
     for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
     {
         tmesh_vec[i]->LoadBndBox();
-        for ( int j = 0 ; j < (int)other_tmesh_vec.size() ; j++ )
-        {
-            if ( tmesh_vec[i]->CheckIntersect( other_tmesh_vec[j] ) )
-            {
-                    intsect_flag = true;
-                    break;
-            }
-        }
-        if ( intsect_flag )
-            break;
     }
 
+    bool intsect_flag = CheckIntersect( tmesh_vec, other_tmesh_vec );
+
     for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
     {
         delete tmesh_vec[i];
@@ -85,6 +79,22 @@ bool SnapTo::CheckIntersect( Geom* geom_ptr, const vector<TMesh*> & other_tmesh_
     return intsect_flag;
 }
 
+//===== Both Vectors of TMeshs with Bounding Boxes Already Set Up ====//
+bool SnapTo::CheckIntersect( const vector<TMesh*> & tmesh_vec, const vector<TMesh*> & other_tmesh_vec )
+{
+    for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
+    {
+        for ( int j = 0 ; j < (int)other_tmesh_vec.size() ; j++ )
+        {
+            if ( tmesh_vec[i]->CheckIntersect( other_tmesh_vec[j] ) )
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 //==== Returns Large Neg Number If Error and 0.0 If Collision ====//
 double SnapTo::FindMinDistance( const string & geom_id, const vector< TMesh* > & other_tmesh_vec, bool & intersect_flag )
 {
@@ -92,23 +102,29 @@ double SnapTo::FindMinDistance( const string & geom_id, const vector< TMesh* > &
     Geom* geom_ptr = VehicleMgr.GetVehicle()->FindGeom( geom_id );
     if ( !geom_ptr )    return -1.0e12;
 
-    if ( CheckIntersect( geom_ptr, other_tmesh_vec ) )
+    //==== Mesh Moving Geom Once For Both Intersect And Distance ====//
+    vector< TMesh* > tmesh_vec = geom_ptr->CreateTMeshVec();        // Must Delete!!!
+    for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
     {
-        intersect_flag = true;
-        return 0.0;
+        tmesh_vec[i]->LoadBndBox();
     }
 
-    vector< TMesh* > tmesh_vec = geom_ptr->CreateTMeshVec();        // Must Delete!!!
-
     //==== Find Min Dist ====//
     double min_dist = 1.0e12;
-    for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
+    if ( CheckIntersect( tmesh_vec, other_tmesh_vec ) )
     {
-        tmesh_vec[i]->LoadBndBox();
-        for ( int j = 0 ; j < (int)other_tmesh_vec.size() ; j++ )
+        intersect_flag = true;
+        min_dist = 0.0;
+    }
+    else
+    {
+        for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
         {
-            double d =  tmesh_vec[i]->MinDistance(  other_tmesh_vec[j], min_dist );
-            min_dist = min( d, min_dist );
+            for ( int j = 0 ; j < (int)other_tmesh_vec.size() ; j++ )
+            {
+                double d =  tmesh_vec[i]->MinDistance(  other_tmesh_vec[j], min_dist );
+                min_dist = min( d, min_dist );
+            }
         }
     }
 
@@ -156,30 +172,8 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
 
     Vehicle* veh = VehicleMgr.GetVehicle();
 
-    //==== Find Other Geoms ====//
-    vector< string > geom_id_vec = veh->GetGeomSet( m_CollisionSet );
-    vector< string > other_geom_vec;
-    for ( int i = 0 ; i < (int)geom_id_vec.size() ; i++ )
-    {
-        if ( geom_id != geom_id_vec[i] )
-            other_geom_vec.push_back( geom_id_vec[i] );
-    }
-
-    //==== Create TMeshes =====//
-    vector< TMesh* > other_tmesh_vec;
-    for ( int i = 0 ; i < (int)other_geom_vec.size() ; i++ )
-    {
-        Geom* g_ptr = veh->FindGeom( other_geom_vec[i] );
-        if ( g_ptr )
-        {
-             vector< TMesh* > tvec = g_ptr->CreateTMeshVec();       /////////// MUST DELETE!!!
-             for ( int j = 0 ; j < (int)tvec.size() ; j++ )
-             {
-                tvec[j]->LoadBndBox();
-                other_tmesh_vec.push_back( tvec[j] );
-             }
-        }
-    }
+    //==== Meshes Of Other Geoms (Owned By Cache) =====//
+    const vector< TMesh* > & other_tmesh_vec = GetOtherTMeshVec( geom_id );
 
     double direction = 1.0;
     if ( !inc_flag )
@@ -291,8 +285,6 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
             m_CollisionErrorFlag = vsp::COLLISION_CLEAR_NO_SOLUTION;
         parm_ptr->Set( revert_val );              // Restore Val
         veh->Update( false );
-        for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-            delete other_tmesh_vec[i];
         return;
     }
 
@@ -372,10 +364,6 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
     m_CollisionMinDist = FindMinDistance( geom_id, other_tmesh_vec, iflag );
     m_CollisionErrorFlag = vsp::COLLISION_OK;
 
-    //==== Delete Created TMeshes ====//
-    for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-        delete other_tmesh_vec[i];
-
     //==== Store Last Results ====//
     m_LastParmID = parm_id;
     m_LastParmVal = parm_ptr->Get();
@@ -398,7 +386,19 @@ void SnapTo::CheckClearance( )
     Geom* geom_ptr = select_vec[0];
     if ( !geom_ptr )    return;
     string geom_id = geom_ptr->GetID();
- 
+
+    //==== Meshes Of Other Geoms (Owned By Cache) =====//
+    const vector< TMesh* > & other_tmesh_vec = GetOtherTMeshVec( geom_id );
+
+    bool iflag;
+    m_CollisionMinDist = FindMinDistance( geom_id, other_tmesh_vec, iflag );
+}
+
+//==== Reuse Meshes Of Other Geoms Unless Set, Moving Geom Or Their Parms Changed ====//
+const vector< TMesh* > & SnapTo::GetOtherTMeshVec( const string & geom_id )
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
     //==== Find Other Geoms ====//
     vector< string > geom_id_vec = veh->GetGeomSet( m_CollisionSet );
     vector< string > other_geom_vec;
@@ -408,28 +408,112 @@ void SnapTo::CheckClearance( )
             other_geom_vec.push_back( geom_id_vec[i] );
     }
 
+    if ( OtherTMeshVecValid( geom_id, other_geom_vec ) )
+    {
+        m_OtherChangeCnt = ParmMgr.GetLastChangeCnt();
+        return m_OtherTMeshVec;
+    }
+
+    ClearOtherTMeshVec();
+
     //==== Create TMeshes =====//
-    vector< TMesh* > other_tmesh_vec;
+    m_OtherReuseFlag = true;
+    m_OtherSurfChangeCntVec.resize( other_geom_vec.size(), 0 );
     for ( int i = 0 ; i < (int)other_geom_vec.size() ; i++ )
     {
         Geom* g_ptr = veh->FindGeom( other_geom_vec[i] );
         if ( g_ptr )
         {
-             vector< TMesh* > tvec = g_ptr->CreateTMeshVec();       /////////// MUST DELETE!!!
-             for ( int j = 0 ; j < (int)tvec.size() ; j++ )
-             {
+            m_OtherSurfChangeCntVec[i] = g_ptr->GetSurfChangeCnt();
+
+            vector< TMesh* > tvec = g_ptr->CreateTMeshVec();
+            for ( int j = 0 ; j < (int)tvec.size() ; j++ )
+            {
                 tvec[j]->LoadBndBox();
-                other_tmesh_vec.push_back( tvec[j] );
-             }
+                m_OtherTMeshVec.push_back( tvec[j] );
+            }
+
+            //==== Geoms Attached Below The Moving Geom Move With It ====//
+            Geom* p_ptr = veh->FindGeom( g_ptr->GetParentID() );
+            for ( int gen = 0 ; p_ptr && gen < 100 ; gen++ )
+            {
+                if ( p_ptr->GetID() == geom_id )
+                {
+                    m_OtherReuseFlag = false;
+                    break;
+                }
+                p_ptr = veh->FindGeom( p_ptr->GetParentID() );
+            }
         }
     }
 
-    bool iflag;
-    m_CollisionMinDist = FindMinDistance( geom_id, other_tmesh_vec, iflag );
+    m_OtherGeomVec = other_geom_vec;
+    m_OtherMovingGeomID = geom_id;
+    m_OtherChangeCnt = ParmMgr.GetLastChangeCnt();
+    m_OtherNumParmChanges = ParmMgr.GetNumParmChanges();
 
-    //==== Delete Created TMeshes ====//
-    for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-        delete other_tmesh_vec[i];
+    return m_OtherTMeshVec;
+}
 
+bool SnapTo::OtherTMeshVecValid( const string & geom_id, const vector< string > & other_geom_vec )
+{
+    if ( !m_OtherReuseFlag || geom_id != m_OtherMovingGeomID || other_geom_vec != m_OtherGeomVec )
+    {
+        return false;
+    }
 
-}
\ No newline at end of file
+    //==== Parms or Containers Added or Removed ====//
+    if ( ParmMgr.GetNumParmChanges() != m_OtherNumParmChanges )
+    {
+        return false;
+    }
+
+    //==== Other Surfaces Rebuilt Without A Parm Change ====//
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    for ( int i = 0 ; i < (int)other_geom_vec.size() ; i++ )
+    {
+        Geom* g_ptr = veh->FindGeom( other_geom_vec[i] );
+        if ( g_ptr && g_ptr->GetSurfChangeCnt() != m_OtherSurfChangeCntVec[i] )
+        {
+            return false;
+        }
+    }
+
+    //==== Any Parm Set Since Meshing Must Belong To The Moving Geom ====//
+    vector< Parm* > parm_vec;
+    ParmMgr.FindChangedParms( m_OtherChangeCnt, parm_vec );
+    for ( int i = 0 ; i < (int)parm_vec.size() ; i++ )
+    {
+        bool moving_flag = false;
+        ParmContainer* pc = parm_vec[i]->GetContainer();
+        for ( int gen = 0 ; pc && gen < 100 ; gen++ )
+        {
+            if ( pc->GetID() == geom_id )
+            {
+                moving_flag = true;
+                break;
+            }
+            pc = pc->GetParentContainerPtr();
+        }
+
+        if ( !moving_flag )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void SnapTo::ClearOtherTMeshVec()
+{
+    for ( int i = 0 ; i < (int)m_OtherTMeshVec.size() ; i++ )
+    {
+        delete m_OtherTMeshVec[i];
+    }
+    m_OtherTMeshVec.clear();
+    m_OtherGeomVec.clear();
+    m_OtherSurfChangeCntVec.clear();
+    m_OtherMovingGeomID.clear();
+    m_OtherReuseFlag = false;
+}
@@ -27,9 +27,13 @@ public:
     double FindMinDistance(const string & geom_id, const vector< TMesh* > & other_tmesh_vec, bool & intersect_flag ); 
     double FindMaxMinDistance( const vector< TMesh* > & mesh_1, const vector< TMesh* > & mesh_2 ); 
     bool CheckIntersect( Geom* geom_ptr, const vector<TMesh*> & other_tmesh_vec );
+    bool CheckIntersect( const vector<TMesh*> & tmesh_vec, const vector<TMesh*> & other_tmesh_vec );
     void AdjParmToMinDist( const string & parm_id, bool inc_flag );
     void CheckClearance(  );
 
+    //==== Free Cached Meshes Of Other Geoms ====//
+    void ClearOtherTMeshVec();
+
 
     //==== Collision Stuff ====//
     BoolParm m_CollisionDetection;
@@ -47,6 +51,18 @@ protected:
     double m_LastTargetDist;
     bool m_LastIncFlag;
 
+    //==== Meshes Of Other Geoms In Collision Set - Kept Until Those Geoms Change ====//
+    const vector< TMesh* > & GetOtherTMeshVec( const string & geom_id );
+    bool OtherTMeshVecValid( const string & geom_id, const vector< string > & other_geom_vec );
+
+    vector< TMesh* > m_OtherTMeshVec;
+    vector< string > m_OtherGeomVec;
+    vector< int > m_OtherSurfChangeCntVec;
+    string m_OtherMovingGeomID;
+    int m_OtherChangeCnt;
+    int m_OtherNumParmChanges;
+    bool m_OtherReuseFlag;
+
 };
 
 
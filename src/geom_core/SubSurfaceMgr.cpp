@@ -15,6 +15,180 @@ using std::vector;
 using std::string;
 using std::map;
 
+//==== Constructor ====//
+SubSurfTagGrid::SubSurfTagGrid()
+{
+    m_DU = m_DW = 1.0;
+    m_NU = m_NW = 0;
+}
+
+//==== Bin Sub-Surface Polygons By Their UW Bounding Boxes ====//
+void SubSurfTagGrid::Build( const vector< SubSurface* > & ss_vec )
+{
+    m_SubSurfVec = ss_vec;
+    m_TagVec.clear();
+    m_LineFlagVec.clear();
+    m_OutsideFlagVec.clear();
+    m_PolySubSurfVec.clear();
+    m_PolyVec.clear();
+    m_PolyBoxVec.clear();
+    m_BinStartVec.clear();
+    m_BinPolyVec.clear();
+    m_NU = m_NW = 0;
+
+    BndBox all_box;
+    for ( int s = 0 ; s < ( int )m_SubSurfVec.size() ; s++ )
+    {
+        SubSurface* ss = m_SubSurfVec[s];
+        m_TagVec.push_back( ss->m_Tag );
+        m_OutsideFlagVec.push_back( ss->m_TestType() == vsp::OUTSIDE );
+        m_LineFlagVec.push_back( ss->GetType() == vsp::SS_LINE );
+        if ( m_LineFlagVec.back() )
+        {
+            continue;
+        }
+
+        //==== Polygon Points Are Built Lazily - Do It Here Before Any Threaded Lookups ====//
+        ss->UpdatePolygonPnts();
+        vector< vector< vec2d > > & poly_vec = ss->GetPolyPntsVec();
+        for ( int p = 0 ; p < ( int )poly_vec.size() ; p++ )
+        {
+            BndBox box;
+            for ( int i = 0 ; i < ( int )poly_vec[p].size() ; i++ )
+            {
+                box.Update( vec3d( poly_vec[p][i].x(), poly_vec[p][i].y(), 0.0 ) );
+            }
+            m_PolySubSurfVec.push_back( s );
+            m_PolyVec.push_back( &poly_vec[p] );
+            m_PolyBoxVec.push_back( box );
+            all_box.Update( box );
+        }
+    }
+
+    int npoly = ( int )m_PolyVec.size();
+    if ( npoly == 0 )
+    {
+        return;
+    }
+
+    //==== Coarse Grid - Sub-Surfaces Are Few and Large Relative To Tris ====//
+    int n = max( 1, min( 64, ( int )ceil( 4.0 * sqrt( ( double )npoly ) ) ) );
+    m_Min = vec2d( all_box.GetMin( 0 ), all_box.GetMin( 1 ) );
+    m_NU = m_NW = n;
+    m_DU = ( all_box.GetMax( 0 ) - all_box.GetMin( 0 ) ) / n;
+    m_DW = ( all_box.GetMax( 1 ) - all_box.GetMin( 1 ) ) / n;
+    if ( m_DU <= 0.0 )
+    {
+        m_DU = 1.0;
+    }
+    if ( m_DW <= 0.0 )
+    {
+        m_DW = 1.0;
+    }
+
+    //==== Count Then Fill - Polygons Enter Each Bin In Ascending Order ====//
+    int nbin = m_NU * m_NW;
+    m_BinStartVec.assign( nbin + 1, 0 );
+    for ( int pass = 0 ; pass < 2 ; pass++ )
+    {
+        vector< int > fill_vec;
+        if ( pass == 1 )
+        {
+            for ( int b = 0 ; b < nbin ; b++ )
+            {
+                m_BinStartVec[b + 1] += m_BinStartVec[b];
+            }
+            m_BinPolyVec.resize( m_BinStartVec[nbin] );
+            fill_vec.assign( m_BinStartVec.begin(), m_BinStartVec.end() - 1 );
+        }
+
+        for ( int p = 0 ; p < npoly ; p++ )
+        {
+            int iu0 = BinIndex( m_PolyBoxVec[p].GetMin( 0 ), m_Min.x(), m_DU, m_NU );
+            int iu1 = BinIndex( m_PolyBoxVec[p].GetMax( 0 ), m_Min.x(), m_DU, m_NU );
+            int iw0 = BinIndex( m_PolyBoxVec[p].GetMin( 1 ), m_Min.y(), m_DW, m_NW );
+            int iw1 = BinIndex( m_PolyBoxVec[p].GetMax( 1 ), m_Min.y(), m_DW, m_NW );
+            for ( int iu = iu0 ; iu <= iu1 ; iu++ )
+            {
+                for ( int iw = iw0 ; iw <= iw1 ; iw++ )
+                {
+                    int b = iu * m_NW + iw;
+                    if ( pass == 0 )
+                    {
+                        m_BinStartVec[b + 1]++;
+                    }
+                    else
+                    {
+                        m_BinPolyVec[ fill_vec[b]++ ] = p;
+                    }
+                }
+            }
+        }
+    }
+}
+
+//==== Same Result As Looping SubSurface::Subtag - Only Polygons Binned At center Are Tested ====//
+void SubSurfTagGrid::Subtag( const vec3d & center, vector< int > & tags ) const
+{
+    vec2d uw( center.x(), center.y() );
+
+    int k = 0;
+    int kend = 0;
+    if ( m_NU > 0 &&
+            uw.x() >= m_Min.x() && uw.x() <= m_Min.x() + m_DU * m_NU &&
+            uw.y() >= m_Min.y() && uw.y() <= m_Min.y() + m_DW * m_NW )
+    {
+        int b = BinIndex( uw.x(), m_Min.x(), m_DU, m_NU ) * m_NW + BinIndex( uw.y(), m_Min.y(), m_DW, m_NW );
+        k = m_BinStartVec[b];
+        kend = m_BinStartVec[b + 1];
+    }
+
+    for ( int s = 0 ; s < ( int )m_SubSurfVec.size() ; s++ )
+    {
+        if ( m_LineFlagVec[s] )
+        {
+            if ( m_SubSurfVec[s]->Subtag( center ) )
+            {
+                tags.push_back( m_TagVec[s] );
+            }
+            continue;
+        }
+
+        //==== Candidates Are Ascending, So Grouped By Sub-Surface ====//
+        bool in_poly = false;
+        for ( ; k < kend && m_PolySubSurfVec[ m_BinPolyVec[k] ] <= s ; k++ )
+        {
+            int p = m_BinPolyVec[k];
+            if ( in_poly || m_PolySubSurfVec[p] != s )
+            {
+                continue;
+            }
+
+            const BndBox & box = m_PolyBoxVec[p];
+            if ( uw.x() < box.GetMin( 0 ) || uw.x() > box.GetMax( 0 ) ||
+                    uw.y() < box.GetMin( 1 ) || uw.y() > box.GetMax( 1 ) )
+            {
+                continue;
+            }
+            in_poly = PointInPolygon( uw, *m_PolyVec[p] );
+        }
+
+        if ( in_poly != ( bool )m_OutsideFlagVec[s] )
+        {
+            tags.push_back( m_TagVec[s] );
+        }
+    }
+}
+
+//==== Bin Along One Axis - Clamped So Boundary Points Land In Edge Bins ====//
+int SubSurfTagGrid::BinIndex( double x, double x0, double dx, int n ) const
+{
+    double ind = floor( ( x - x0 ) / dx );
+    ind = min( max( ind, 0.0 ), ( double )( n - 1 ) );
+    return ( int )ind;
+}
+
+//////////////////////////////////////////////////////////////////////
 SubSurfaceMgrSingleton::SubSurfaceMgrSingleton()
 {
     m_CurrSurfInd = -1;
@@ -25,6 +25,47 @@
 #include <map>
 #include <set>
 
+//==== Uniform UW Grid Of Sub-Surface Polygons - Tags Match SubSurface::Subtag ====//
+class SubSurfTagGrid
+{
+public:
+
+    SubSurfTagGrid();
+
+    void Build( const std::vector< SubSurface* > & ss_vec );
+
+    //==== Append Tags Of Sub-Surfaces Containing center, In Sub-Surface Order ====//
+    void Subtag( const vec3d & center, std::vector< int > & tags ) const;
+
+    int GetNumSubSurfs() const
+    {
+        return ( int )m_SubSurfVec.size();
+    }
+
+protected:
+
+    int BinIndex( double x, double x0, double dx, int n ) const;
+
+    std::vector< SubSurface* > m_SubSurfVec;
+    std::vector< int > m_TagVec;
+    std::vector< char > m_LineFlagVec;              // SSLine - Half Plane Test
+    std::vector< char > m_OutsideFlagVec;
+
+    //==== Polygons In Sub-Surface Order ====//
+    std::vector< int > m_PolySubSurfVec;
+    std::vector< const std::vector< vec2d >* > m_PolyVec;
+    std::vector< BndBox > m_PolyBoxVec;
+
+    //==== Polygon Indices Per Bin, Ascending ====//
+    vec2d m_Min;
+    double m_DU;
+    double m_DW;
+    int m_NU;
+    int m_NW;
+    std::vector< int > m_BinStartVec;
+    std::vector< int > m_BinPolyVec;
+};
+
 class SubSurfaceMgrSingleton
 {
 private:
@@ -24,6 +24,12 @@
 #include "triangle.h"
 #include "Geom.h"
 #include "SubSurfaceMgr.h"
+#include "WriteBuffer.h"
+#include "CompressUtil.h"
+#include "PntHash.h"
+
+#include <climits>
+#include <queue>
 
 
 //===============================================//
@@ -368,6 +374,7 @@ TMesh::TMesh()
     m_HalfBoxFlag = false;
     m_SurfNum = 0;
     m_AreaCenter = vec3d(0,0,0);
+    m_TBox.SetArena( &m_Arena );
 }
 
 TMesh::~TMesh()
@@ -398,10 +405,10 @@ void TMesh::copy( TMesh* m )
 
     for ( int i = 0 ; i < ( int )m->m_TVec.size() ; i++ )
     {
-        TTri* tri = new TTri();
-        tri->m_N0   = new TNode();
-        tri->m_N1   = new TNode();
-        tri->m_N2   = new TNode();
+        TTri* tri = new ( &m_Arena ) TTri();
+        tri->m_N0   = new ( &m_Arena ) TNode();
+        tri->m_N1   = new ( &m_Arena ) TNode();
+        tri->m_N2   = new ( &m_Arena ) TNode();
 
         tri->m_Norm    = m->m_TVec[i]->m_Norm;
         tri->m_N0->m_Pnt = m->m_TVec[i]->m_N0->m_Pnt;
@@ -475,11 +482,18 @@ void TMesh::CopyAttributes( TMesh* m )
     m_AreaCenter = m->m_AreaCenter;
 }
 
-xmlNodePtr TMesh::EncodeXml( xmlNodePtr & node )
+xmlNodePtr TMesh::EncodeXml( xmlNodePtr & node, bool binary_flag )
 {
     xmlNodePtr tmesh_node = xmlNewChild( node, NULL, BAD_CAST "TMesh", NULL );
     XmlUtil::AddIntNode( tmesh_node, "Num_Tris", ( int )m_TVec.size() );
-    EncodeTriList( tmesh_node );
+    if ( binary_flag )
+    {
+        EncodeTriData( tmesh_node );
+    }
+    else
+    {
+        EncodeTriList( tmesh_node );
+    }
     return tmesh_node;
 }
 
@@ -499,8 +513,233 @@ xmlNodePtr TMesh::EncodeTriList( xmlNodePtr & node )
     return tri_list_node;
 }
 
+//==== Exact Coordinate Bits - Keeps -0.0 Apart From 0.0 So Encoding Is Lossless ====//
+static inline void PntBits( const vec3d & p, unsigned long long bits[3] )
+{
+    double d[3] = { p.x(), p.y(), p.z() };
+    memcpy( bits, d, sizeof( d ) );
+}
+
+//==== Unique Points Of tri_vec Nodes In First Use Order, 3 Indices Per Tri ====//
+static void IndexTriPnts( const vector< TTri* > & tri_vec, vector< vec3d > & pnt_vec, vector< int > & ind_vec )
+{
+    size_t num = 3 * tri_vec.size();
+    size_t table_size = 16;
+    while ( table_size < 2 * num )
+    {
+        table_size <<= 1;
+    }
+    size_t mask = table_size - 1;
+
+    vector< int > table( table_size, -1 );
+    vector< unsigned long long > bit_vec;
+    bit_vec.reserve( num );
+
+    pnt_vec.clear();
+    ind_vec.resize( num );
+    for ( size_t t = 0 ; t < tri_vec.size() ; t++ )
+    {
+        TNode* nodes[3] = { tri_vec[t]->m_N0, tri_vec[t]->m_N1, tri_vec[t]->m_N2 };
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            unsigned long long bits[3];
+            PntBits( nodes[k]->m_Pnt, bits );
+
+            unsigned long long h = 1469598103934665603ULL;
+            for ( int i = 0 ; i < 3 ; i++ )
+            {
+                h = ( h ^ bits[i] ) * 1099511628211ULL;
+                h ^= h >> 29;
+            }
+
+            size_t slot = ( size_t )h & mask;
+            while ( table[ slot ] >= 0 && memcmp( &bit_vec[ 3 * table[ slot ] ], bits, sizeof( bits ) ) != 0 )
+            {
+                slot = ( slot + 1 ) & mask;
+            }
+            if ( table[ slot ] < 0 )
+            {
+                table[ slot ] = ( int )pnt_vec.size();
+                pnt_vec.push_back( nodes[k]->m_Pnt );
+                bit_vec.insert( bit_vec.end(), bits, bits + 3 );
+            }
+            ind_vec[ 3 * t + k ] = table[ slot ];
+        }
+    }
+}
+
+//==== Pack Doubles With Like Bytes Grouped ====//
+static void PackDoubles( const vector< double > & dvec, unsigned char* out )
+{
+    if ( !dvec.empty() )
+    {
+        ShuffleBytes( ( const unsigned char* )&dvec[0], dvec.size(), sizeof( double ), out );
+    }
+}
+
+static void UnpackDoubles( const unsigned char* in, vector< double > & dvec )
+{
+    if ( !dvec.empty() )
+    {
+        UnshuffleBytes( in, dvec.size(), sizeof( double ), ( unsigned char* )&dvec[0] );
+    }
+}
+
+//==== Unique Points, Delta Coded Tri Indices and Normals In One Compressed Blob ====//
+xmlNodePtr TMesh::EncodeTriData( xmlNodePtr & node )
+{
+    vector< vec3d > pnt_vec;
+    vector< int > ind_vec;
+    IndexTriPnts( m_TVec, pnt_vec, ind_vec );
+
+    int num_pnts = ( int )pnt_vec.size();
+    int num_tris = ( int )m_TVec.size();
+
+    vector< double > pnt_dvec( 3 * num_pnts );
+    for ( int i = 0 ; i < num_pnts ; i++ )
+    {
+        pnt_dvec[ 3 * i ] = pnt_vec[i].x();
+        pnt_dvec[ 3 * i + 1 ] = pnt_vec[i].y();
+        pnt_dvec[ 3 * i + 2 ] = pnt_vec[i].z();
+    }
+    vector< vec3d >().swap( pnt_vec );
+
+    //==== Neighboring Tris Share Points - Zigzag Deltas Are Mostly Small ====//
+    vector< unsigned int > delta_vec( ind_vec.size() );
+    int prev = 0;
+    for ( int i = 0 ; i < ( int )ind_vec.size() ; i++ )
+    {
+        int d = ind_vec[i] - prev;
+        prev = ind_vec[i];
+        delta_vec[i] = ( ( unsigned int )d << 1 ) ^ ( unsigned int )( d >> 31 );
+    }
+
+    vector< double > norm_dvec( 3 * num_tris );
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        norm_dvec[ 3 * i ] = m_TVec[i]->m_Norm.x();
+        norm_dvec[ 3 * i + 1 ] = m_TVec[i]->m_Norm.y();
+        norm_dvec[ 3 * i + 2 ] = m_TVec[i]->m_Norm.z();
+    }
+
+    size_t pnt_size = pnt_dvec.size() * sizeof( double );
+    size_t ind_size = delta_vec.size() * sizeof( unsigned int );
+    //==== Blob Sizes Are Stored As int ====//
+    size_t data_size = pnt_size + ind_size + norm_dvec.size() * sizeof( double );
+    if ( data_size > INT_MAX )
+    {
+        return EncodeTriList( node );
+    }
+
+    vector< unsigned char > data( data_size );
+
+    PackDoubles( pnt_dvec, data.data() );
+    if ( !delta_vec.empty() )
+    {
+        ShuffleBytes( ( const unsigned char* )&delta_vec[0], delta_vec.size(), sizeof( unsigned int ), data.data() + pnt_size );
+    }
+    PackDoubles( norm_dvec, data.data() + pnt_size + ind_size );
+
+    xmlNodePtr tri_data_node = XmlUtil::AddBlobNode( node, "Tri_Data", data );
+    XmlUtil::SetIntProp( tri_data_node, "Version", TRI_DATA_VERSION );
+    XmlUtil::SetIntProp( tri_data_node, "Num_Pnts", num_pnts );
+    XmlUtil::SetIntProp( tri_data_node, "Num_Tris", num_tris );
+
+    return tri_data_node;
+}
+
+//==== False If Version Is Unknown Or Data Is Inconsistent - Mesh Is Left Empty ====//
+bool TMesh::DecodeTriData( xmlNodePtr & node )
+{
+    int version = XmlUtil::FindIntProp( node, "Version", 0 );
+    if ( version != TRI_DATA_VERSION )
+    {
+        fprintf( stderr, "TMesh Tri_Data version %d not supported\n", version );
+        return false;
+    }
+
+    int num_pnts = XmlUtil::FindIntProp( node, "Num_Pnts", -1 );
+    int num_tris = XmlUtil::FindIntProp( node, "Num_Tris", -1 );
+    if ( num_pnts < 0 || num_tris < 0 )
+    {
+        return false;
+    }
+
+    size_t pnt_size = 3 * ( size_t )num_pnts * sizeof( double );
+    size_t ind_size = 3 * ( size_t )num_tris * sizeof( unsigned int );
+    size_t norm_size = 3 * ( size_t )num_tris * sizeof( double );
+
+    vector< unsigned char > data;
+    if ( !XmlUtil::ExtractBlobNode( node, data ) || data.size() != pnt_size + ind_size + norm_size )
+    {
+        fprintf( stderr, "TMesh Tri_Data is corrupt\n" );
+        return false;
+    }
+
+    vector< double > pnt_dvec( 3 * num_pnts );
+    UnpackDoubles( data.data(), pnt_dvec );
+
+    vector< unsigned int > delta_vec( 3 * num_tris );
+    if ( !delta_vec.empty() )
+    {
+        UnshuffleBytes( data.data() + pnt_size, delta_vec.size(), sizeof( unsigned int ), ( unsigned char* )&delta_vec[0] );
+    }
+
+    vector< double > norm_dvec( 3 * num_tris );
+    UnpackDoubles( data.data() + pnt_size + ind_size, norm_dvec );
+
+    vector< unsigned char >().swap( data );
+
+    vector< int > ind_vec( delta_vec.size() );
+    int prev = 0;
+    for ( int i = 0 ; i < ( int )delta_vec.size() ; i++ )
+    {
+        int d = ( int )( delta_vec[i] >> 1 ) ^ -( int )( delta_vec[i] & 1 );
+        prev += d;
+        if ( prev < 0 || prev >= num_pnts )
+        {
+            fprintf( stderr, "TMesh Tri_Data is corrupt\n" );
+            return false;
+        }
+        ind_vec[i] = prev;
+    }
+
+    //==== Each Tri Gets Its Own Nodes, Same As The Tri_List Encoding ====//
+    m_TVec.resize( num_tris );
+    size_t num_nodes = m_NVec.size();
+    m_NVec.resize( num_nodes + 3 * num_tris );
+
+    #pragma omp parallel for
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        TTri* tri = new ( &m_Arena ) TTri();
+        TNode* nodes[3];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            int p = ind_vec[ 3 * i + k ];
+            nodes[k] = new ( &m_Arena ) TNode();
+            nodes[k]->m_Pnt = vec3d( pnt_dvec[ 3 * p ], pnt_dvec[ 3 * p + 1 ], pnt_dvec[ 3 * p + 2 ] );
+            m_NVec[ num_nodes + 3 * i + k ] = nodes[k];
+        }
+        tri->m_N0 = nodes[0];
+        tri->m_N1 = nodes[1];
+        tri->m_N2 = nodes[2];
+        tri->m_Norm = vec3d( norm_dvec[ 3 * i ], norm_dvec[ 3 * i + 1 ], norm_dvec[ 3 * i + 2 ] );
+        m_TVec[i] = tri;
+    }
+
+    return true;
+}
+
 void TMesh::DecodeXml( xmlNodePtr & node )
 {
+    xmlNodePtr tri_data_node = XmlUtil::GetNode( node, "Tri_Data", 0 );
+    if ( tri_data_node )
+    {
+        DecodeTriData( tri_data_node );
+        return;
+    }
+
     xmlNodePtr tri_list_node = XmlUtil::GetNode( node, "Tri_List", 0 );
     if ( tri_list_node )
     {
@@ -535,11 +774,11 @@ void TMesh::DecodeTriList( xmlNodePtr & node, int num_tris )
         if ( !xmlStrcmp( iter_node->name, ( const xmlChar * )"Tri" ) )
         {
             tri = XmlUtil::GetVectorVec3dNode( iter_node );
-            m_TVec[i] = new TTri();
+            m_TVec[i] = new ( &m_Arena ) TTri();
             // Create Nodes
-            m_TVec[i]->m_N0 = new TNode();
-            m_TVec[i]->m_N1 = new TNode();
-            m_TVec[i]->m_N2 = new TNode();
+            m_TVec[i]->m_N0 = new ( &m_Arena ) TNode();
+            m_TVec[i]->m_N1 = new ( &m_Arena ) TNode();
+            m_TVec[i]->m_N2 = new ( &m_Arena ) TNode();
 
             m_NVec.push_back( m_TVec[i]->m_N0 );
             m_NVec.push_back( m_TVec[i]->m_N1 );
@@ -742,18 +981,25 @@ double TMesh::MinDistance( TMesh* tm, double curr_min_dist )
     return m_TBox.MinDistance( &tm->m_TBox, curr_min_dist );
 }
 
+//==== Tris Own Their Nodes and Intersection Edges So Each Splits Independently ====//
 void TMesh::Split()
 {
     int t;
-    for ( t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    int ntri = ( int )m_TVec.size();
+
+#pragma omp parallel for schedule( dynamic, 16 )
+    for ( t = 0 ; t < ntri ; t++ )
     {
-        m_TVec[t]->SplitTri();
+        m_TVec[t]->SplitTri( &m_Arena );
     }
 }
 
 
-void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
+//==== Unsplit Tris and Split Children In Tri Order - Split Parents Are Interior ====//
+void TMesh::LoadDeterIntExtTris( vector< TTri* > & tri_vec )
 {
+    tri_vec.clear();
+    tri_vec.reserve( m_TVec.size() );
     for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
         TTri* tri = m_TVec[t];
@@ -764,17 +1010,35 @@ void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
             tri->m_InteriorFlag = 1;
             for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
             {
-                DeterIntExtTri( tri->m_SplitVec[s], meshVec );
+                tri_vec.push_back( tri->m_SplitVec[s] );
             }
         }
         else
         {
-            DeterIntExtTri( tri, meshVec );
+            tri_vec.push_back( tri );
+        }
+    }
+}
+
+void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
+{
+    vector< TTri* > tri_vec;
+    LoadDeterIntExtTris( tri_vec );
+    int ntri = ( int )tri_vec.size();
+
+    #pragma omp parallel
+    {
+        vector< double > tParmVec;
+
+        #pragma omp for schedule( dynamic, 64 )
+        for ( int t = 0 ; t < ntri ; t++ )
+        {
+            DeterIntExtTri( tri_vec[t], meshVec, tParmVec );
         }
     }
 }
 
-void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec, vector< double > & tParmVec )
 {
     vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
     orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
@@ -786,7 +1050,7 @@ void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
     {
         if ( meshVec[m] != this )
         {
-            vector<double > tParmVec;
+            tParmVec.clear();
             meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
             if ( tParmVec.size() % 2 )
             {
@@ -799,28 +1063,24 @@ void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
 
 void TMesh::MassDeterIntExt( vector< TMesh* >& meshVec )
 {
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    vector< TTri* > tri_vec;
+    LoadDeterIntExtTris( tri_vec );
+    int ntri = ( int )tri_vec.size();
+
+    #pragma omp parallel
     {
-        TTri* tri = m_TVec[t];
+        vector< double > tParmVec;
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
-        {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
-            {
-                MassDeterIntExtTri( tri->m_SplitVec[s], meshVec );
-            }
-        }
-        else
+        #pragma omp for schedule( dynamic, 64 )
+        for ( int t = 0 ; t < ntri ; t++ )
         {
-            MassDeterIntExtTri( tri, meshVec );
+            MassDeterIntExtTri( tri_vec[t], meshVec, tParmVec );
         }
     }
 }
 
 
-void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec, vector< double > & tParmVec )
 {
     vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
     orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
@@ -833,7 +1093,7 @@ void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
     {
         if ( meshVec[m] != this )
         {
-            vector<double > tParmVec;
+            tParmVec.clear();
             meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
             if ( tParmVec.size() % 2 )
             {
@@ -851,27 +1111,23 @@ void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
 
 void TMesh::WaveDeterIntExt( vector< TMesh* >& meshVec )
 {
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    vector< TTri* > tri_vec;
+    LoadDeterIntExtTris( tri_vec );
+    int ntri = ( int )tri_vec.size();
+
+    #pragma omp parallel
     {
-        TTri* tri = m_TVec[t];
+        vector< double > tParmVec;
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
+        #pragma omp for schedule( dynamic, 64 )
+        for ( int t = 0 ; t < ntri ; t++ )
         {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
-            {
-                WaveDeterIntExtTri( tri->m_SplitVec[s], meshVec );
-            }
-        }
-        else
-        {
-            WaveDeterIntExtTri( tri, meshVec );
+            WaveDeterIntExtTri( tri_vec[t], meshVec, tParmVec );
         }
     }
 }
 
-void TMesh::WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+void TMesh::WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec, vector< double > & tParmVec )
 {
     vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
     orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
@@ -884,7 +1140,7 @@ void TMesh::WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
     {
         if ( meshVec[m] != this )
         {
-            vector<double > tParmVec;
+            tParmVec.clear();
             meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
             if ( tParmVec.size() % 2 )
             {
@@ -1033,13 +1289,13 @@ double TMesh::ComputeTrimVol()
 void TMesh::AddTri( const vec3d & v0, const vec3d & v1, const vec3d & v2, const vec3d & norm )
 {
     // Use For XYZ Tri
-    TTri* ttri = new TTri();
+    TTri* ttri = new ( &m_Arena ) TTri();
     ttri->m_Norm = norm;
     ttri->SetTMeshPtr( this );
 
-    ttri->m_N0 = new TNode();
-    ttri->m_N1 = new TNode();
-    ttri->m_N2 = new TNode();
+    ttri->m_N0 = new ( &m_Arena ) TNode();
+    ttri->m_N1 = new ( &m_Arena ) TNode();
+    ttri->m_N2 = new ( &m_Arena ) TNode();
 
     ttri->m_N0->m_Pnt = v0;
     ttri->m_N1->m_Pnt = v1;
@@ -1057,13 +1313,13 @@ void TMesh::AddTri( const vec3d & v0, const vec3d & v1, const vec3d & v2, const
 
 void TMesh::AddTri( TNode* node0, TNode* node1, TNode* node2, const vec3d & norm )
 {
-    TTri* ttri = new TTri();
+    TTri* ttri = new ( &m_Arena ) TTri();
     ttri->m_Norm = norm;
     ttri->SetTMeshPtr( this );
 
-    ttri->m_N0 = new TNode();
-    ttri->m_N1 = new TNode();
-    ttri->m_N2 = new TNode();
+    ttri->m_N0 = new ( &m_Arena ) TNode();
+    ttri->m_N1 = new ( &m_Arena ) TNode();
+    ttri->m_N2 = new ( &m_Arena ) TNode();
 
     ttri->m_N0->m_Pnt = node0->m_Pnt;
     ttri->m_N1->m_Pnt = node1->m_Pnt;
@@ -1109,9 +1365,9 @@ void TMesh::AddTri( const vec3d & v0, const vec3d & v1, const vec3d & v2, const
 void TMesh::AddTri( const TTri* tri)
 {
     // Copys and existing triangle and pushes back into the existing
-    TTri* new_tri = new TTri();
+    TTri* new_tri = new ( &m_Arena ) TTri();
 
-    new_tri->CopyFrom( tri );
+    new_tri->CopyFrom( tri, &m_Arena );
     m_TVec.push_back( new_tri );
     m_NVec.push_back( new_tri->m_N0 );
     m_NVec.push_back( new_tri->m_N1 );
@@ -1121,13 +1377,13 @@ void TMesh::AddTri( const TTri* tri)
 void TMesh::AddUWTri( const vec3d & uw0, const vec3d & uw1, const vec3d & uw2, const vec3d & norm )
 {
     // Use For XYZ Tri
-    TTri* ttri = new TTri();
+    TTri* ttri = new ( &m_Arena ) TTri();
     ttri->m_Norm = norm;
     ttri->SetTMeshPtr( this );
 
-    ttri->m_N0 = new TNode();
-    ttri->m_N1 = new TNode();
-    ttri->m_N2 = new TNode();
+    ttri->m_N0 = new ( &m_Arena ) TNode();
+    ttri->m_N1 = new ( &m_Arena ) TNode();
+    ttri->m_N2 = new ( &m_Arena ) TNode();
 
     ttri->m_N0->m_Pnt = uw0;
     ttri->m_N1->m_Pnt = uw1;
@@ -1159,72 +1415,119 @@ void TMesh::LoadBndBox()
     m_TBox.SplitBox();
 }
 
-//==== Write STL Tris =====//
-void TMesh::WriteSTLTris( FILE* file_id, Matrix4d XFormMat )
+//==== Exterior Tris And Exterior Split Tris In Output Order =====//
+void TMesh::FindSTLTris( vector< TTri* > & tri_vec )
 {
-    int t, s;
-    vec3d norm;
-    vec3d v0, v1, v2;
-    vec3d d30, d21;
-
-    for ( t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
         TTri* tri = m_TVec[t];
 
         if ( tri->m_SplitVec.size() )
         {
-            for ( s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
+            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
             {
                 if ( !tri->m_SplitVec[s]->m_InteriorFlag )
                 {
-                    v0 = XFormMat.xform( tri->m_SplitVec[s]->m_N0->m_Pnt );
-                    v1 = XFormMat.xform( tri->m_SplitVec[s]->m_N1->m_Pnt );
-                    v2 = XFormMat.xform( tri->m_SplitVec[s]->m_N2->m_Pnt );
-
-                    d21 = v2 - v1;
-
-                    if ( d21.mag() > 0.000001 )
-                    {
-                        norm = cross( d21, v0 - v1 );
-                        norm.normalize();
-
-                        fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-                        fprintf( file_id, "   outer loop\n" );
-                        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v0.x(), v0.y(), v0.z() );
-                        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v1.x(), v1.y(), v1.z() );
-                        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v2.x(), v2.y(), v2.z() );
-                        fprintf( file_id, "   endloop\n" );
-                        fprintf( file_id, " endfacet\n" );
-                    }
+                    tri_vec.push_back( tri->m_SplitVec[s] );
                 }
             }
         }
-        else
+        else if ( !tri->m_InteriorFlag )
         {
-            if ( !tri->m_InteriorFlag )
-            {
-                v0 = XFormMat.xform( tri->m_N0->m_Pnt );
-                v1 = XFormMat.xform( tri->m_N1->m_Pnt );
-                v2 = XFormMat.xform( tri->m_N2->m_Pnt );
+            tri_vec.push_back( tri );
+        }
+    }
+}
+
+//==== Transformed Facet - False If Degenerate =====//
+static bool STLFacet( const TTri* tri, const Matrix4d & XFormMat, vec3d & norm, vec3d & v0, vec3d & v1, vec3d & v2 )
+{
+    v0 = XFormMat.xform( tri->m_N0->m_Pnt );
+    v1 = XFormMat.xform( tri->m_N1->m_Pnt );
+    v2 = XFormMat.xform( tri->m_N2->m_Pnt );
 
-                d21 = v2 - v1;
+    vec3d d21 = v2 - v1;
 
-                if ( d21.mag() > 0.000001 )
-                {
-                    norm = cross( d21, v0 - v1 );
-                    norm.normalize();
-
-                    fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-                    fprintf( file_id, "   outer loop\n" );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v0.x(), v0.y(), v0.z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v1.x(), v1.y(), v1.z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v2.x(), v2.y(), v2.z() );
-                    fprintf( file_id, "   endloop\n" );
-                    fprintf( file_id, " endfacet\n" );
-                }
-            }
+    if ( d21.mag() > 0.000001 )
+    {
+        norm = cross( d21, v0 - v1 );
+        norm.normalize();
+        return true;
+    }
+    return false;
+}
+
+//==== Write STL Tris =====//
+void TMesh::WriteSTLTris( FILE* file_id, Matrix4d XFormMat )
+{
+    vector< TTri* > tri_vec;
+    FindSTLTris( tri_vec );
+
+    WriteBuffer::WriteParallel( file_id, ( int )tri_vec.size(), [&]( WriteBuffer & buf, int i )
+    {
+        vec3d norm, v0, v1, v2;
+        if ( STLFacet( tri_vec[i], XFormMat, norm, v0, v1, v2 ) )
+        {
+            WriteSTLFacet( buf, norm, v0, v1, v2 );
         }
+    } );
+}
+
+//==== Write Binary STL Tris - Returns Number of Facets Written =====//
+int TMesh::WriteBinSTLTris( FILE* file_id, Matrix4d XFormMat )
+{
+    vector< TTri* > tri_vec;
+    FindSTLTris( tri_vec );
+
+    size_t num_bytes = WriteBuffer::WriteParallel( file_id, ( int )tri_vec.size(), [&]( WriteBuffer & buf, int i )
+    {
+        vec3d norm, v0, v1, v2;
+        if ( STLFacet( tri_vec[i], XFormMat, norm, v0, v1, v2 ) )
+        {
+            WriteBinSTLFacet( buf, norm, v0, v1, v2 );
+        }
+    } );
+
+    return ( int )( num_bytes / BIN_STL_FACET_SIZE );
+}
+
+//==== Same Text As fprintf With " %2.10le" Fields =====//
+static void AppendSTLVec( WriteBuffer & buf, const vec3d & v )
+{
+    buf.AppendExp( v.x(), 10 );
+    buf.Append( " ", 1 );
+    buf.AppendExp( v.y(), 10 );
+    buf.Append( " ", 1 );
+    buf.AppendExp( v.z(), 10 );
+    buf.Append( "\n", 1 );
+}
+
+void TMesh::WriteSTLFacet( WriteBuffer & buf, const vec3d & norm, const vec3d & v0, const vec3d & v1, const vec3d & v2 )
+{
+    buf.Append( " facet normal  " );
+    AppendSTLVec( buf, norm );
+    buf.Append( "   outer loop\n" );
+    buf.Append( "     vertex " );
+    AppendSTLVec( buf, v0 );
+    buf.Append( "     vertex " );
+    AppendSTLVec( buf, v1 );
+    buf.Append( "     vertex " );
+    AppendSTLVec( buf, v2 );
+    buf.Append( "   endloop\n" );
+    buf.Append( " endfacet\n" );
+}
+
+//==== Normal, Vertices As Little Endian Floats Then Zero Attribute Count =====//
+void TMesh::WriteBinSTLFacet( WriteBuffer & buf, const vec3d & norm, const vec3d & v0, const vec3d & v1, const vec3d & v2 )
+{
+    const vec3d* v[4] = { &norm, &v0, &v1, &v2 };
+    for ( int k = 0 ; k < 4 ; k++ )
+    {
+        buf.AppendBinFloat( ( float )v[k]->x() );
+        buf.AppendBinFloat( ( float )v[k]->y() );
+        buf.AppendBinFloat( ( float )v[k]->z() );
     }
+    buf.Append( "\0\0", 2 );
 }
 
 vec3d TMesh::GetVertex( int index )
@@ -1259,9 +1562,6 @@ int TMesh::NumVerts()
 
 TTri::TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Construct Cnt = %d \n", cnt);
     m_E0 = m_E1 = m_E2 = 0;
     m_N0 = m_N1 = m_N2 = 0;
     m_InteriorFlag = 0;
@@ -1273,9 +1573,6 @@ TTri::TTri()
 
 TTri::~TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Destruct Cnt = %d \n", cnt);
     int i;
 
     //==== Delete Split Edges ====//
@@ -1311,11 +1608,11 @@ TTri::~TTri()
 
 }
 
-void TTri::CopyFrom( const TTri* tri )
+void TTri::CopyFrom( const TTri* tri, TMeshArena* arena )
 {
-    m_N0 = new TNode();
-    m_N1 = new TNode();
-    m_N2 = new TNode();
+    m_N0 = new ( arena ) TNode();
+    m_N1 = new ( arena ) TNode();
+    m_N2 = new ( arena ) TNode();
 
     m_N0->CopyFrom( tri->m_N0 );
     m_N1->CopyFrom( tri->m_N1 );
@@ -1329,7 +1626,7 @@ void TTri::CopyFrom( const TTri* tri )
     m_InteriorFlag = tri->m_InteriorFlag;
 }
 
-void TTri::BuildPermEdges()
+void TTri::BuildPermEdges( TMeshArena* arena )
 {
     if ( m_PEArr[0] )
     {
@@ -1341,9 +1638,9 @@ void TTri::BuildPermEdges()
     }
     if ( m_N0 != NULL && m_N1 != NULL && m_N2 != NULL )
     {
-        m_PEArr[0] = new TEdge( m_N0, m_N1, this );
-        m_PEArr[1] = new TEdge( m_N1, m_N2, this );
-        m_PEArr[2] = new TEdge( m_N2, m_N0, this );
+        m_PEArr[0] = new ( arena ) TEdge( m_N0, m_N1, this );
+        m_PEArr[1] = new ( arena ) TEdge( m_N1, m_N2, this );
+        m_PEArr[2] = new ( arena ) TEdge( m_N2, m_N0, this );
     }
 }
 
@@ -1434,7 +1731,7 @@ bool TTri::MatchEdge( TNode* n0, TNode* n1, TNode* nA, TNode* nB, double tol )
 }
 
 //==== Split A Triangle Along Edges in ISectEdges Vec =====//
-void TTri::SplitTri()
+void TTri::SplitTri( TMeshArena* arena )
 {
     int i, j;
     double onEdgeTol = 0.00001;
@@ -1489,7 +1786,7 @@ void TTri::SplitTri()
     //==== Add Edges For Perimeter ====//
     for ( i = 0 ; i < 3 ; i++ )
     {
-        m_EVec.push_back(  new TEdge() );
+        m_EVec.push_back(  new ( arena ) TEdge() );
     }
 
     m_EVec[0]->m_N0 = m_N0;
@@ -1536,7 +1833,7 @@ void TTri::SplitTri()
             if ( onEdgeFlag )
             {
                 //==== SplitEdge ====//
-                TNode* sn = new TNode();        // New node
+                TNode* sn = new ( arena ) TNode();        // New node
                 sn->m_IsectFlag = 1;
                 m_NVec.push_back( sn );
                 matchNodeIndex[i] = m_NVec.size() - 1;
@@ -1546,7 +1843,7 @@ void TTri::SplitTri()
                 {
                     sn->MakePntUW();
                 }
-                TEdge* se = new TEdge();        // New Edge
+                TEdge* se = new ( arena ) TEdge();        // New Edge
                 se->m_N0 = m_EVec[j]->m_N0;
                 se->m_N1 = sn;
                 m_EVec[j]->m_N0 = sn;               // Change Split Edge
@@ -1585,7 +1882,7 @@ void TTri::SplitTri()
         //==== Didnt Find One - Add New ====//
         if ( matchNodeIndex[i] == -1 )
         {
-            TNode* sn = new TNode();        // New node
+            TNode* sn = new ( arena ) TNode();        // New node
             sn->m_IsectFlag = 1;
             m_NVec.push_back( sn );
             matchNodeIndex[i] = m_NVec.size() - 1;
@@ -1621,7 +1918,7 @@ void TTri::SplitTri()
 
             if ( !existFlag )
             {
-                TEdge* se = new TEdge();        // New Edge
+                TEdge* se = new ( arena ) TEdge();        // New Edge
                 se->m_N0 = m_NVec[ind0];
                 se->m_N1 = m_NVec[ind1];
                 m_EVec.push_back( se );
@@ -1675,7 +1972,7 @@ void TTri::SplitTri()
                         else if ( u < uvMinTol && v >= uvMinTol && v <= uvMaxTol )
                         {
                             //==== Break Along Line Seg 2 ====//
-                            TEdge* se = new TEdge();        // New Edge
+                            TEdge* se = new ( arena ) TEdge();        // New Edge
                             se->m_N0 = en0;
                             se->m_N1 = en3;
                             m_EVec[j]->m_N0 = en2;
@@ -1685,7 +1982,7 @@ void TTri::SplitTri()
                         else if ( u > uvMaxTol && v >= uvMinTol && v <= uvMaxTol )
                         {
                             //==== Break Along Line Seg 2 ====//
-                            TEdge* se = new TEdge();        // New Edge
+                            TEdge* se = new ( arena ) TEdge();        // New Edge
                             se->m_N0 = en1;
                             se->m_N1 = en3;
                             m_EVec[j]->m_N0 = en2;
@@ -1695,7 +1992,7 @@ void TTri::SplitTri()
                         else if ( v < uvMinTol && u >= uvMinTol && u <= uvMaxTol )
                         {
                             //==== Break Along Line Seg 1 ====//
-                            TEdge* se = new TEdge();        // New Edge
+                            TEdge* se = new ( arena ) TEdge();        // New Edge
                             se->m_N0 = en2;
                             se->m_N1 = en1;
                             m_EVec[i]->m_N0 = en2;
@@ -1705,7 +2002,7 @@ void TTri::SplitTri()
                         else if ( v > uvMaxTol && u >= uvMinTol && u <= uvMaxTol )
                         {
                             //==== Break Along Line Seg 1 ====//
-                            TEdge* se = new TEdge();        // New Edge
+                            TEdge* se = new ( arena ) TEdge();        // New Edge
                             se->m_N0 = en3;
                             se->m_N1 = en1;
                             m_EVec[i]->m_N0 = en3;
@@ -1715,7 +2012,7 @@ void TTri::SplitTri()
                         else
                         {
                             //==== New Node at Crossing Point ====//
-                            TNode* sn = new TNode();
+                            TNode* sn = new ( arena ) TNode();
                             sn->m_IsectFlag = 1;
                             m_NVec.push_back( sn );
 
@@ -1737,12 +2034,12 @@ void TTri::SplitTri()
                                 sn->SetXYZPnt( crossing_node );
                             }
 
-                            TEdge* se0 = new TEdge();       // New Edge
+                            TEdge* se0 = new ( arena ) TEdge();       // New Edge
                             se0->m_N0 = en0;
                             se0->m_N1 = sn;
                             m_EVec[i]->m_N0 = sn;
                             m_EVec[i]->m_N1 = en1;
-                            TEdge* se1 = new TEdge();       // New Edge
+                            TEdge* se1 = new ( arena ) TEdge();       // New Edge
                             se1->m_N0 = en2;
                             se1->m_N1 = sn;
                             m_EVec[j]->m_N0 = sn;
@@ -1767,11 +2064,16 @@ void TTri::SplitTri()
     }
 
     //==== Determine Which Axis to Flatten ====//
-    Matrix4d rot_mat;
+    //==== Rotated Copies Of Node Points - Corner Nodes May Be Shared With Tris Splitting On Other Threads ====//
+    vector< vec3d > flatPntVec( m_NVec.size() );
     int flattenAxis = 0;
     if ( uwflag )
     {
         flattenAxis = 2;
+        for ( unsigned int n=0; n < m_NVec.size(); n++ )
+        {
+            flatPntVec[n] = m_NVec[n]->m_Pnt;
+        }
     }
     else
     {
@@ -1783,26 +2085,17 @@ void TTri::SplitTri()
         vec3d axis = cross(m_Norm,vec3d(1,0,0));
 
         // Rotate Points
+        Matrix4d rot_mat;
         rot_mat.rotate(std::acos(costheta), axis);
 
         for ( unsigned int n=0; n < m_NVec.size(); n++ )
         {
-            m_NVec[n]->m_Pnt = rot_mat.xform(m_NVec[n]->m_Pnt);
+            flatPntVec[n] = rot_mat.xform(m_NVec[n]->m_Pnt);
         }
     }
 
     //==== Use Triangle to Split Tri ====//
-    TriangulateSplit( flattenAxis );
-
-    if ( !uwflag )
-    {
-        // Rotate Points Back
-        rot_mat.affineInverse();
-        for ( unsigned int n=0; n < m_NVec.size(); n++ )
-        {
-            m_NVec[n]->m_Pnt = rot_mat.xform(m_NVec[n]->m_Pnt);
-        }
-    }
+    TriangulateSplit( flattenAxis, flatPntVec, arena );
 
     //=== Orient Tris to Match Normal ====//
     for ( i = 0 ; i < ( int )m_SplitVec.size() ; i++ )
@@ -1822,7 +2115,7 @@ void TTri::SplitTri()
     }
 }
 
-void TTri::TriangulateSplit( int flattenAxis )
+void TTri::TriangulateSplit( int flattenAxis, const vector< vec3d > & flatPntVec, TMeshArena* arena )
 {
     int i, j;
 
@@ -1862,7 +2155,7 @@ void TTri::TriangulateSplit( int flattenAxis )
     BndBox box;
     for ( j = 0 ; j < ( int )m_NVec.size() ; j++ )
     {
-        box.Update( m_NVec[j]->m_Pnt );
+        box.Update( flatPntVec[j] );
     }
 
     vec3d center = box.GetCenter();
@@ -1875,7 +2168,7 @@ void TTri::TriangulateSplit( int flattenAxis )
     int cnt = 0;
     for ( j = 0 ; j < ( int )m_NVec.size() ; j++ )
     {
-        vec3d pnt = m_NVec[j]->m_Pnt - center;
+        vec3d pnt = flatPntVec[j] - center;
         pnt.scale_x( 1.0 / sx );
         pnt.scale_y( 1.0 / sy );
         pnt.scale_z( 1.0 / sz );
@@ -1985,7 +2278,7 @@ void TTri::TriangulateSplit( int flattenAxis )
                 out.trianglelist[cnt + 1] < ( int )m_NVec.size() &&
                 out.trianglelist[cnt + 2] < ( int )m_NVec.size() )
         {
-            TTri* t = new TTri();
+            TTri* t = new ( arena ) TTri();
             t->m_N0 = m_NVec[out.trianglelist[cnt]];
             t->m_N1 = m_NVec[out.trianglelist[cnt + 1]];
             t->m_N2 = m_NVec[out.trianglelist[cnt + 2]];
@@ -2168,607 +2461,949 @@ void TTri::SplitEdges( TNode* n01, TNode* n12, TNode* n20 )
 
 TBndBox::TBndBox()
 {
-    for ( int i = 0 ; i < 8 ; i++ )
-    {
-        m_SBoxVec[i] = 0;
-    }
+    m_Arena = NULL;
 }
 
 TBndBox::~TBndBox()
 {
-    for ( int i = 0 ; i < 8 ; i++ )
-    {
-        delete m_SBoxVec[i];
-    }
 }
 
 void TBndBox::Reset()
 {
-    for ( int i = 0 ; i < 8 ; i++ )
-    {
-        delete m_SBoxVec[i];
-        m_SBoxVec[i] = 0;
-    }
-
     m_Box.Reset();
     m_TriVec.clear();
+    m_NodeVec.clear();
+    m_PntVec.clear();
 }
 
-//==== Create Oct Tree of Overlaping BndBoxes ====//
-void TBndBox::SplitBox()
+//==== Surface Area Of Min/Max Bounds ====//
+static double BndArea( const double* bmin, const double* bmax )
 {
-    int i;
-    if ( m_TriVec.size() > 32 )
-    {
-        //==== Find Split Points ====//
-        double hx = 0.5 * ( m_Box.GetMax( 0 ) + m_Box.GetMin( 0 ) );
-        double hy = 0.5 * ( m_Box.GetMax( 1 ) + m_Box.GetMin( 1 ) );
-        double hz = 0.5 * ( m_Box.GetMax( 2 ) + m_Box.GetMin( 2 ) );
-
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i] = new TBndBox();
-        }
-
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-        {
-            int cnt = 0;
-            if ( m_TriVec[i]->m_N0->m_Pnt.x() > hx )
-            {
-                cnt += 1;
-            }
-            if ( m_TriVec[i]->m_N0->m_Pnt.y() > hy )
-            {
-                cnt += 2;
-            }
-            if ( m_TriVec[i]->m_N0->m_Pnt.z() > hz )
-            {
-                cnt += 4;
-            }
-            m_SBoxVec[cnt]->AddTri( m_TriVec[i] );
-        }
-
-        int contSplitFlag = 1;
+    double dx = bmax[0] - bmin[0];
+    double dy = bmax[1] - bmin[1];
+    double dz = bmax[2] - bmin[2];
+    return 2.0 * ( dx * dy + dy * dz + dz * dx );
+}
 
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            if ( m_TriVec.size() == m_SBoxVec[i]->m_TriVec.size() )
-            {
-                contSplitFlag = 0;
-                break;
-            }
-        }
-        if ( contSplitFlag )
-        {
-            for ( i = 0 ; i < 8 ; i++ )
-            {
-                m_SBoxVec[i]->SplitBox();
-            }
-        }
+static void ResetBnd( double* bmin, double* bmax )
+{
+    for ( int a = 0 ; a < 3 ; a++ )
+    {
+        bmin[a] = 1.0e12;
+        bmax[a] = -1.0e12;
     }
 }
 
-void TBndBox::AddTri( TTri* t )
+static void UpdateBnd( double* bmin, double* bmax, const double* umin, const double* umax )
 {
-    m_TriVec.push_back( t );
-    m_Box.Update( t->m_N0->m_Pnt );
-    m_Box.Update( t->m_N1->m_Pnt );
-    m_Box.Update( t->m_N2->m_Pnt );
+    for ( int a = 0 ; a < 3 ; a++ )
+    {
+        bmin[a] = min( bmin[a], umin[a] );
+        bmax[a] = max( bmax[a], umax[a] );
+    }
 }
 
-void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
+//==== Same Test As Compare( BndBox, BndBox, tol ) ====//
+static bool NodeOverlap( const TBndBoxNode & n0, const TBndBoxNode & n1, double tol )
 {
-    int i;
-
-    if ( m_SBoxVec[0] )     // Keep Moving Down
+    for ( int a = 0 ; a < 3 ; a++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        if ( ( n1.m_Min[a] - n0.m_Max[a] ) > tol || ( n0.m_Min[a] - n1.m_Max[a] ) > tol )
         {
-            m_SBoxVec[i]->AddLeafNodes( leafVec );
+            return false;
         }
     }
-    else
+    return true;
+}
+
+//==== Squared Distance Between Boxes - Zero If Overlapping ====//
+static double NodeDistSquared( const TBndBoxNode & n0, const TBndBoxNode & n1 )
+{
+    double d2 = 0.0;
+    for ( int a = 0 ; a < 3 ; a++ )
     {
-        leafVec.push_back( this );
+        double gap = max( n1.m_Min[a] - n0.m_Max[a], n0.m_Min[a] - n1.m_Max[a] );
+        if ( gap > 0.0 )
+        {
+            d2 += gap * gap;
+        }
     }
+    return d2;
 }
 
-bool TBndBox::CheckIntersect( TBndBox* iBox  )
+//==== Descend Into n0 Before n1 - Leaves Are Never Descended ====//
+static bool DescendFirst( const TBndBoxNode & n0, const TBndBoxNode & n1 )
 {
-    int i, j;
-
-    //==== Compare Bounding Boxes ====//
-    if ( !Compare( m_Box, iBox->m_Box ) )
+    if ( n0.m_NumTris > 0 )
     {
         return false;
     }
-
-    //==== Recursively Check Sub Boxes ====//
-    if ( m_SBoxVec[0] )
+    if ( n1.m_NumTris > 0 )
     {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-           if ( iBox->CheckIntersect( m_SBoxVec[i] ) )
-           return true;
-        }
+        return true;
     }
-    else if ( iBox->m_SBoxVec[0] )
+    return BndArea( n0.m_Min, n0.m_Max ) >= BndArea( n1.m_Min, n1.m_Max );
+}
+
+//==== Intersection Segment Of A Tri Pair ====//
+struct TTriISectSeg
+{
+    TTri* m_T0;
+    TTri* m_T1;
+    vec3d m_E0;
+    vec3d m_E1;
+};
+
+//==== Add T To Parm Vec If Not Already Included ====//
+static void AddUniqueTParm( double tparm, vector<double> & tParmVec )
+{
+    for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        if ( fabs( tparm - tParmVec[j] ) < 0.0000001 )
         {
-            if ( iBox->m_SBoxVec[i]->CheckIntersect( this ) )
-                return true;
+            return;
         }
     }
-    else
+    tParmVec.push_back( tparm );
+}
+
+//==== Create Bounding Volume Hierarchy Of Tris ====//
+void TBndBox::SplitBox()
+{
+    int i;
+    int num = ( int )m_TriVec.size();
+
+    m_NodeVec.clear();
+    m_PntVec.clear();
+
+    if ( num == 0 )
     {
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
+        return;
+    }
 
-        //==== Check All Tris In One Box Against The Other ====//
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+    m_TriBndVec.resize( 6 * num );
+    m_CenterVec.resize( 3 * num );
+    m_IndVec.resize( num );
+
+#pragma omp parallel for
+    for ( i = 0 ; i < num ; i++ )
+    {
+        TTri* t = m_TriVec[i];
+        double* bmin = &m_TriBndVec[ 6 * i ];
+        double* bmax = bmin + 3;
+        for ( int a = 0 ; a < 3 ; a++ )
         {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
-            {
-                TTri* t1 = iBox->m_TriVec[j];
+            bmin[a] = min( t->m_N0->m_Pnt[a], min( t->m_N1->m_Pnt[a], t->m_N2->m_Pnt[a] ) );
+            bmax[a] = max( t->m_N0->m_Pnt[a], max( t->m_N1->m_Pnt[a], t->m_N2->m_Pnt[a] ) );
+            m_CenterVec[ 3 * i + a ] = 0.5 * ( bmin[a] + bmax[a] );
+        }
+        m_IndVec[i] = i;
+    }
 
-                int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
+    //==== Sparse Build - Each Subtree Owns 2 * NumTris - 1 Slots So Tasks Never Collide ====//
+    m_BuildNodeVec.resize( 2 * num - 1 );
 
-                if ( iflag && !coplanarFlag )
-                    return true;
-            }
-        }
+#pragma omp parallel
+    {
+#pragma omp single
+        BuildNode( 0, 0, num, 0 );
     }
-    return false;
+
+    //==== Compact Nodes With Siblings Adjacent ====//
+    m_NodeVec.reserve( m_BuildNodeVec.size() );
+    m_NodeVec.resize( 1 );
+    FlattenNode( 0, 0 );
+
+    //==== Tris and Vertices In Leaf Order ====//
+    vector< TTri* > tri_vec( num );
+    m_PntVec.resize( 3 * num );
+    for ( i = 0 ; i < num ; i++ )
+    {
+        TTri* t = m_TriVec[ m_IndVec[i] ];
+        tri_vec[i] = t;
+        m_PntVec[ 3 * i ] = t->m_N0->m_Pnt;
+        m_PntVec[ 3 * i + 1 ] = t->m_N1->m_Pnt;
+        m_PntVec[ 3 * i + 2 ] = t->m_N2->m_Pnt;
+    }
+    m_TriVec.swap( tri_vec );
+
+    vector< double >().swap( m_TriBndVec );
+    vector< double >().swap( m_CenterVec );
+    vector< int >().swap( m_IndVec );
+    vector< TBndBoxNode >().swap( m_BuildNodeVec );
 }
 
-double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
+void TBndBox::BuildNode( int node, int start, int num, int depth )
 {
-    int i, j;
+    int i, a, b;
 
-    //==== Compare Bounding Boxes ====//
-    if ( !Compare( m_Box, iBox->m_Box, curr_min_dist ) )
+    TBndBoxNode & n = m_BuildNodeVec[node];
+    double cmin[3], cmax[3];
+    ResetBnd( n.m_Min, n.m_Max );
+    ResetBnd( cmin, cmax );
+    for ( i = start ; i < start + num ; i++ )
     {
-        return curr_min_dist;
+        const double* tbnd = &m_TriBndVec[ 6 * m_IndVec[i] ];
+        const double* c = &m_CenterVec[ 3 * m_IndVec[i] ];
+        UpdateBnd( n.m_Min, n.m_Max, tbnd, tbnd + 3 );
+        UpdateBnd( cmin, cmax, c, c );
+    }
+    n.m_Start = start;
+    n.m_NumTris = num;
+
+    if ( num <= 2 || depth >= MAX_DEPTH )
+    {
+        return;
     }
 
-    //==== Recursively Check Sub Boxes ====//
-    if ( m_SBoxVec[0] )
+    //==== Bin Centers Along Each Axis ====//
+    double bin_min[3][NUM_SAH_BINS][3];
+    double bin_max[3][NUM_SAH_BINS][3];
+    int bin_cnt[3][NUM_SAH_BINS];
+    double bin_scale[3];
+
+    for ( a = 0 ; a < 3 ; a++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        double extent = cmax[a] - cmin[a];
+        bin_scale[a] = ( extent > 0.0 ) ? NUM_SAH_BINS / extent : 0.0;
+        for ( b = 0 ; b < NUM_SAH_BINS ; b++ )
         {
-            curr_min_dist = iBox->MinDistance( m_SBoxVec[i], curr_min_dist );
+            ResetBnd( bin_min[a][b], bin_max[a][b] );
+            bin_cnt[a][b] = 0;
         }
     }
-    else if ( iBox->m_SBoxVec[0] )
+
+    for ( i = start ; i < start + num ; i++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        int ind = m_IndVec[i];
+        const double* tbnd = &m_TriBndVec[ 6 * ind ];
+        for ( a = 0 ; a < 3 ; a++ )
         {
-            curr_min_dist = iBox->m_SBoxVec[i]->MinDistance( this, curr_min_dist );
+            int bin = min( ( int )( ( m_CenterVec[ 3 * ind + a ] - cmin[a] ) * bin_scale[a] ), ( int )NUM_SAH_BINS - 1 );
+            UpdateBnd( bin_min[a][bin], bin_max[a][bin], tbnd, tbnd + 3 );
+            bin_cnt[a][bin]++;
         }
     }
-    //==== Check All Points Against Other Points ====//
-    else
+
+    //==== Sweep For Lowest SAH Cost ====//
+    int best_axis = -1;
+    int best_bin = 0;
+    double best_cost = 0.0;
+
+    for ( a = 0 ; a < 3 ; a++ )
     {
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        if ( bin_scale[a] == 0.0 )
         {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
-            {
+            continue;
+        }
 
-                TTri* t1 = iBox->m_TriVec[j];
-                double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
-                                             t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt);
+        double right_area[NUM_SAH_BINS];
+        int right_cnt[NUM_SAH_BINS];
+        double smin[3], smax[3];
+        int cnt = 0;
+        ResetBnd( smin, smax );
+        for ( b = NUM_SAH_BINS - 1 ; b > 0 ; b-- )
+        {
+            UpdateBnd( smin, smax, bin_min[a][b], bin_max[a][b] );
+            cnt += bin_cnt[a][b];
+            right_area[b] = BndArea( smin, smax );
+            right_cnt[b] = cnt;
+        }
 
-                if ( d < curr_min_dist )
-                    curr_min_dist = d;
+        cnt = 0;
+        ResetBnd( smin, smax );
+        for ( b = 1 ; b < NUM_SAH_BINS ; b++ )
+        {
+            UpdateBnd( smin, smax, bin_min[a][b - 1], bin_max[a][b - 1] );
+            cnt += bin_cnt[a][b - 1];
+            if ( cnt == 0 || right_cnt[b] == 0 )
+            {
+                continue;
+            }
+            double cost = BndArea( smin, smax ) * cnt + right_area[b] * right_cnt[b];
+            if ( best_axis < 0 || cost < best_cost )
+            {
+                best_axis = a;
+                best_bin = b;
+                best_cost = cost;
             }
         }
     }
 
-    return curr_min_dist;
+    //==== Leaf If Splitting Does Not Pay ====//
+    int num_left;
+    if ( best_axis < 0 )
+    {
+        //==== Coincident Centers - Halve Until Leaf Is Small ====//
+        if ( num <= MAX_LEAF_TRIS )
+        {
+            return;
+        }
+        num_left = num / 2;
+    }
+    else
+    {
+        double area = BndArea( n.m_Min, n.m_Max );
+        double split_cost = ( area > 0.0 ) ? 1.0 + best_cost / area : 1.0 + 0.5 * num;
+        if ( num <= MAX_LEAF_TRIS && split_cost >= num )
+        {
+            return;
+        }
+
+        double c0 = cmin[best_axis];
+        double scale = bin_scale[best_axis];
+        const double* center = &m_CenterVec[ best_axis ];
+        int* mid = partition( &m_IndVec[start], &m_IndVec[start] + num, [&]( int ind )
+        {
+            return min( ( int )( ( center[ 3 * ind ] - c0 ) * scale ), ( int )NUM_SAH_BINS - 1 ) < best_bin;
+        } );
+        num_left = ( int )( mid - &m_IndVec[start] );
+    }
+
+    int left = node + 1;
+    int right = node + 2 * num_left;
+    n.m_Start = right;
+    n.m_NumTris = 0;
+
+    if ( num > PARALLEL_BUILD_TRIS )
+    {
+#pragma omp task
+        BuildNode( left, start, num_left, depth + 1 );
+
+        BuildNode( right, start + num_left, num - num_left, depth + 1 );
+
+#pragma omp taskwait
+    }
+    else
+    {
+        BuildNode( left, start, num_left, depth + 1 );
+        BuildNode( right, start + num_left, num - num_left, depth + 1 );
+    }
 }
 
+void TBndBox::FlattenNode( int node, int flat )
+{
+    const TBndBoxNode & n = m_BuildNodeVec[node];
+    m_NodeVec[flat] = n;
 
-void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
+    if ( n.m_NumTris > 0 )
+    {
+        return;
+    }
+
+    int child = ( int )m_NodeVec.size();
+    m_NodeVec[flat].m_Start = child;
+    m_NodeVec.resize( child + 2 );
+
+    FlattenNode( node + 1, child );
+    FlattenNode( n.m_Start, child + 1 );
+}
+
+void TBndBox::AddTri( TTri* t )
 {
-    int i;
+    m_TriVec.push_back( t );
+    m_Box.Update( t->m_N0->m_Pnt );
+    m_Box.Update( t->m_N1->m_Pnt );
+    m_Box.Update( t->m_N2->m_Pnt );
+}
 
-    if ( !Compare( m_Box, iBox->m_Box ) )
+void TBndBox::FindLeafPairs( TBndBox* iBox, vector< pair< int, int > > & leaf_pair_vec, double tol )
+{
+    if ( m_NodeVec.empty() || iBox->m_NodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    vector< pair< int, int > > stack_vec;
+    stack_vec.push_back( pair< int, int >( 0, 0 ) );
+
+    while ( !stack_vec.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        pair< int, int > p = stack_vec.back();
+        stack_vec.pop_back();
+
+        const TBndBoxNode & n0 = m_NodeVec[p.first];
+        const TBndBoxNode & n1 = iBox->m_NodeVec[p.second];
+
+        if ( !NodeOverlap( n0, n1, tol ) )
         {
-            iBox->Intersect( m_SBoxVec[i], UWFlag );
+            continue;
         }
-    }
-    else if ( iBox->m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
+
+        if ( DescendFirst( n0, n1 ) )
         {
-            iBox->m_SBoxVec[i]->Intersect( this, UWFlag );
+            stack_vec.push_back( pair< int, int >( n0.m_Start + 1, p.second ) );
+            stack_vec.push_back( pair< int, int >( n0.m_Start, p.second ) );
+        }
+        else if ( n1.m_NumTris == 0 )
+        {
+            stack_vec.push_back( pair< int, int >( p.first, n1.m_Start + 1 ) );
+            stack_vec.push_back( pair< int, int >( p.first, n1.m_Start ) );
+        }
+        else
+        {
+            leaf_pair_vec.push_back( p );
         }
     }
-    else
+}
+
+bool TBndBox::CheckIntersect( TBndBox* iBox  )
+{
+    int i, j;
+
+    if ( m_NodeVec.empty() || iBox->m_NodeVec.empty() )
     {
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
+        return false;
+    }
+
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    vector< pair< int, int > > stack_vec;
+    stack_vec.push_back( pair< int, int >( 0, 0 ) );
+
+    while ( !stack_vec.empty() )
+    {
+        pair< int, int > p = stack_vec.back();
+        stack_vec.pop_back();
+
+        const TBndBoxNode & n0 = m_NodeVec[p.first];
+        const TBndBoxNode & n1 = iBox->m_NodeVec[p.second];
 
-        int iCnt = 0;
+        //==== Compare Bounding Boxes ====//
+        if ( !NodeOverlap( n0, n1, 1.0e-12 ) )
+        {
+            continue;
+        }
 
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        if ( DescendFirst( n0, n1 ) )
         {
-            TTri* t0 = m_TriVec[i];
-            for ( int j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
+            stack_vec.push_back( pair< int, int >( n0.m_Start + 1, p.second ) );
+            stack_vec.push_back( pair< int, int >( n0.m_Start, p.second ) );
+            continue;
+        }
+        else if ( n1.m_NumTris == 0 )
+        {
+            stack_vec.push_back( pair< int, int >( p.first, n1.m_Start + 1 ) );
+            stack_vec.push_back( pair< int, int >( p.first, n1.m_Start ) );
+            continue;
+        }
+
+        //==== Check All Tris In One Leaf Against The Other ====//
+        for ( i = n0.m_Start ; i < n0.m_Start + n0.m_NumTris ; i++ )
+        {
+            vec3d* p0 = &m_PntVec[ 3 * i ];
+            for ( j = n1.m_Start ; j < n1.m_Start + n1.m_NumTris ; j++ )
             {
-                TTri* t1 = iBox->m_TriVec[j];
+                vec3d* p1 = &iBox->m_PntVec[ 3 * j ];
 
                 int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                                p0[0].v, p0[1].v, p0[2].v,
+                                p1[0].v, p1[1].v, p1[2].v,
                                 &coplanarFlag, e0.v, e1.v );
 
-                iCnt += iflag;
                 if ( iflag && !coplanarFlag )
                 {
-                    if ( UWFlag )
-                    {
-                        if ( dist( e0, e1 ) > 0.000001 )
-                        {
-                            // Figure out with tri has xyz info
-                            TTri* tri;
-                            int d_info = TNode::HAS_XYZ; // desired info number
-                            if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
-                                    && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
-                            {
-                                tri = t0;
-                            }
-                            else
-                            {
-                                tri = t1;
-                            }
-                            // Use Bilinear interpolation to convert edge uw points to xyz points
-                            vec3d e0xyz = tri->CompPnt( e0 );
-                            vec3d e1xyz = tri->CompPnt( e1 );
-
-                            // Create the new edges
-
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->SetUWPnt( e0 );
-                            ie0->m_N0->SetXYZPnt( e0xyz );
-                            ie0->m_N0->MakePntUW();
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->SetUWPnt( e1 );
-                            ie0->m_N1->SetXYZPnt( e1xyz );
-                            ie0->m_N1->MakePntUW();
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->SetUWPnt( e0 );
-                            ie1->m_N0->SetXYZPnt( e0xyz );
-                            ie1->m_N0->MakePntUW();
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->SetUWPnt( e1 );
-                            ie1->m_N1->SetXYZPnt( e1xyz );
-                            ie1->m_N1->MakePntUW();
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-
-                            if ( tri->GetTMeshPtr() )
-                            {
-                                tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
-                            }
-
-                        }
-                    }
-                    else
-                    {
-                        TEdge* ie0 = new TEdge();
-                        ie0->m_N0 = new TNode();
-                        ie0->m_N0->m_Pnt = e0;
-                        ie0->m_N1 = new TNode();
-                        ie0->m_N1->m_Pnt = e1;
-
-                        TEdge* ie1 = new TEdge();
-                        ie1->m_N0 = new TNode();
-                        ie1->m_N0->m_Pnt = e0;
-                        ie1->m_N1 = new TNode();
-                        ie1->m_N1->m_Pnt = e1;
-
-
-                        if ( dist( e0, e1 ) > 0.000001 )
-                        {
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-                        }
-                        else
-                        {
-                            delete ie0->m_N0;
-                            delete ie0->m_N1;
-                            delete ie1->m_N0;
-                            delete ie1->m_N1;
-                            delete ie0;
-                            delete ie1;
-                        }
-                    }
+                    return true;
                 }
             }
         }
     }
+    return false;
 }
-void  TBndBox::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
+
+double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
 {
-    int i;
+    int i, j;
 
-    if ( orig.y() < m_Box.GetMin( 1 ) )
+    if ( m_NodeVec.empty() || iBox->m_NodeVec.empty() )
     {
-        return;
-    }
-    if ( orig.y() > m_Box.GetMax( 1 ) )
-    {
-        return;
-    }
-    if ( orig.z() < m_Box.GetMin( 2 ) )
-    {
-        return;
-    }
-    if ( orig.z() > m_Box.GetMax( 2 ) )
-    {
-        return;
+        return curr_min_dist;
     }
 
-    if ( m_SBoxVec[0] )
+    //==== Best First - Node Pairs Ordered By Box Distance Lower Bound ====//
+    typedef pair< double, pair< int, int > > TNodePairDist;
+    priority_queue< TNodePairDist, vector< TNodePairDist >, greater< TNodePairDist > > pair_queue;
+    pair_queue.push( TNodePairDist( NodeDistSquared( m_NodeVec[0], iBox->m_NodeVec[0] ), pair< int, int >( 0, 0 ) ) );
+
+    while ( !pair_queue.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        //==== Remaining Pairs Are At Least This Far Apart ====//
+        double lower_d2 = pair_queue.top().first;
+        if ( lower_d2 >= curr_min_dist * curr_min_dist )
         {
-            m_SBoxVec[i]->NumCrossXRay( orig, tParmVec );
+            break;
         }
-        return;
-    }
 
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-    vec3d dir( 1.0, 0.0, 0.0 );
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-    {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+        pair< int, int > p = pair_queue.top().second;
+        pair_queue.pop();
+
+        const TBndBoxNode & n0 = m_NodeVec[p.first];
+        const TBndBoxNode & n1 = iBox->m_NodeVec[p.second];
 
-        if ( iFlag && tparm > 0.0 )
+        if ( DescendFirst( n0, n1 ) )
         {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+            for ( int c = n0.m_Start ; c <= n0.m_Start + 1 ; c++ )
             {
-                if ( fabs( tparm - tParmVec[j] ) < 0.0000001 )
+                double d2 = NodeDistSquared( m_NodeVec[c], n1 );
+                if ( d2 < curr_min_dist * curr_min_dist )
                 {
-                    dupFlag = 1;
-                    break;
+                    pair_queue.push( TNodePairDist( d2, pair< int, int >( c, p.second ) ) );
                 }
             }
+            continue;
+        }
+        else if ( n1.m_NumTris == 0 )
+        {
+            for ( int c = n1.m_Start ; c <= n1.m_Start + 1 ; c++ )
+            {
+                double d2 = NodeDistSquared( n0, iBox->m_NodeVec[c] );
+                if ( d2 < curr_min_dist * curr_min_dist )
+                {
+                    pair_queue.push( TNodePairDist( d2, pair< int, int >( p.first, c ) ) );
+                }
+            }
+            continue;
+        }
 
-            if ( !dupFlag )
+        //==== Check All Tris Against Other Tris - Skip Pairs Whose Boxes Are Too Far Apart ====//
+        for ( i = n0.m_Start ; i < n0.m_Start + n0.m_NumTris ; i++ )
+        {
+            vec3d* p0 = &m_PntVec[ 3 * i ];
+            TBndBoxNode t0;
+            for ( int a = 0 ; a < 3 ; a++ )
             {
-                tParmVec.push_back( tparm );
+                t0.m_Min[a] = min( p0[0].v[a], min( p0[1].v[a], p0[2].v[a] ) );
+                t0.m_Max[a] = max( p0[0].v[a], max( p0[1].v[a], p0[2].v[a] ) );
+            }
+
+            for ( j = n1.m_Start ; j < n1.m_Start + n1.m_NumTris ; j++ )
+            {
+                vec3d* p1 = &iBox->m_PntVec[ 3 * j ];
+                TBndBoxNode t1;
+                for ( int a = 0 ; a < 3 ; a++ )
+                {
+                    t1.m_Min[a] = min( p1[0].v[a], min( p1[1].v[a], p1[2].v[a] ) );
+                    t1.m_Max[a] = max( p1[0].v[a], max( p1[1].v[a], p1[2].v[a] ) );
+                }
+
+                if ( NodeDistSquared( t0, t1 ) >= curr_min_dist * curr_min_dist )
+                {
+                    continue;
+                }
+
+                double d = tri_tri_min_dist( p0[0], p0[1], p0[2], p1[0], p1[1], p1[2] );
+
+                if ( d < curr_min_dist )
+                {
+                    curr_min_dist = d;
+                }
             }
         }
     }
 
+    return curr_min_dist;
 }
 
-void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
+
+void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
 {
-    int i;
+    int l;
 
-    double coord[3];
+    vector< pair< int, int > > leaf_pair_vec;
+    FindLeafPairs( iBox, leaf_pair_vec );
+    int num_pairs = ( int )leaf_pair_vec.size();
+
+    //==== Intersect Leaf Pairs Concurrently - Segments Buffered Per Pair ====//
+    vector< vector< TTriISectSeg > > seg_vec( num_pairs );
 
-    if( !intersectRayAABB( m_Box.GetMin().v, m_Box.GetMax().v, orig.v, dir.v, coord ) )
+#pragma omp parallel for schedule( dynamic, 16 )
+    for ( l = 0 ; l < num_pairs ; l++ )
     {
-        return;
+        const TBndBoxNode & n0 = m_NodeVec[ leaf_pair_vec[l].first ];
+        const TBndBoxNode & n1 = iBox->m_NodeVec[ leaf_pair_vec[l].second ];
+
+        int coplanarFlag;
+        TTriISectSeg seg;
+
+        for ( int i = n0.m_Start ; i < n0.m_Start + n0.m_NumTris ; i++ )
+        {
+            vec3d* p0 = &m_PntVec[ 3 * i ];
+            for ( int j = n1.m_Start ; j < n1.m_Start + n1.m_NumTris ; j++ )
+            {
+                vec3d* p1 = &iBox->m_PntVec[ 3 * j ];
+
+                int iflag = tri_tri_intersect_with_isectline(
+                                p0[0].v, p0[1].v, p0[2].v,
+                                p1[0].v, p1[1].v, p1[2].v,
+                                &coplanarFlag, seg.m_E0.v, seg.m_E1.v );
+
+                if ( iflag && !coplanarFlag )
+                {
+                    seg.m_T0 = m_TriVec[i];
+                    seg.m_T1 = iBox->m_TriVec[j];
+                    seg_vec[l].push_back( seg );
+                }
+            }
+        }
     }
 
-    if ( m_SBoxVec[0] )
+    //==== Add Intersection Edges In Leaf Pair Order So Results Do Not Depend On Threads ====//
+    for ( l = 0 ; l < num_pairs ; l++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        for ( int s = 0 ; s < ( int )seg_vec[l].size() ; s++ )
         {
-            m_SBoxVec[i]->RayCast( orig, dir, tParmVec );
+            TTri* t0 = seg_vec[l][s].m_T0;
+            TTri* t1 = seg_vec[l][s].m_T1;
+            vec3d e0 = seg_vec[l][s].m_E0;
+            vec3d e1 = seg_vec[l][s].m_E1;
+
+            if ( UWFlag )
+            {
+                if ( dist( e0, e1 ) > 0.000001 )
+                {
+                    // Figure out with tri has xyz info
+                    TTri* tri;
+                    int d_info = TNode::HAS_XYZ; // desired info number
+                    if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
+                            && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
+                    {
+                        tri = t0;
+                    }
+                    else
+                    {
+                        tri = t1;
+                    }
+                    // Use Bilinear interpolation to convert edge uw points to xyz points
+                    vec3d e0xyz = tri->CompPnt( e0 );
+                    vec3d e1xyz = tri->CompPnt( e1 );
+
+                    // Create the new edges
+
+                    TEdge* ie0 = new ( m_Arena ) TEdge();
+                    int info = TNode::HAS_UW | TNode::HAS_XYZ;
+                    ie0->m_N0 = new ( m_Arena ) TNode();
+                    ie0->m_N0->SetUWPnt( e0 );
+                    ie0->m_N0->SetXYZPnt( e0xyz );
+                    ie0->m_N0->MakePntUW();
+                    ie0->m_N0->SetCoordInfo( info );
+                    ie0->m_N1 = new ( m_Arena ) TNode();
+                    ie0->m_N1->SetUWPnt( e1 );
+                    ie0->m_N1->SetXYZPnt( e1xyz );
+                    ie0->m_N1->MakePntUW();
+                    ie0->m_N1->SetCoordInfo( info );
+
+                    TEdge* ie1 = new ( iBox->m_Arena ) TEdge();
+                    ie1->m_N0 = new ( iBox->m_Arena ) TNode();
+                    ie1->m_N0->SetUWPnt( e0 );
+                    ie1->m_N0->SetXYZPnt( e0xyz );
+                    ie1->m_N0->MakePntUW();
+                    ie1->m_N0->SetCoordInfo( info );
+                    ie1->m_N1 = new ( iBox->m_Arena ) TNode();
+                    ie1->m_N1->SetUWPnt( e1 );
+                    ie1->m_N1->SetXYZPnt( e1xyz );
+                    ie1->m_N1->MakePntUW();
+                    ie1->m_N1->SetCoordInfo( info );
+
+                    t0->m_ISectEdgeVec.push_back( ie0 );
+                    t1->m_ISectEdgeVec.push_back( ie1 );
+
+                    if ( tri->GetTMeshPtr() )
+                    {
+                        tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
+                    }
+
+                }
+            }
+            else
+            {
+                if ( dist( e0, e1 ) > 0.000001 )
+                {
+                    TEdge* ie0 = new ( m_Arena ) TEdge();
+                    ie0->m_N0 = new ( m_Arena ) TNode();
+                    ie0->m_N0->m_Pnt = e0;
+                    ie0->m_N1 = new ( m_Arena ) TNode();
+                    ie0->m_N1->m_Pnt = e1;
+
+                    TEdge* ie1 = new ( iBox->m_Arena ) TEdge();
+                    ie1->m_N0 = new ( iBox->m_Arena ) TNode();
+                    ie1->m_N0->m_Pnt = e0;
+                    ie1->m_N1 = new ( iBox->m_Arena ) TNode();
+                    ie1->m_N1->m_Pnt = e1;
+
+                    t0->m_ISectEdgeVec.push_back( ie0 );
+                    t1->m_ISectEdgeVec.push_back( ie1 );
+                }
+            }
         }
+    }
+}
+void TBndBox::IntersectTris( const vector< TTri* > & tri_vec )
+{
+    if ( m_NodeVec.empty() )
+    {
         return;
     }
 
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
+    int stack[ 2 * MAX_DEPTH + 2 ];
+    int coplanarFlag;
+    vec3d e0, e1;
 
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+    for ( int t = 0 ; t < ( int )tri_vec.size() ; t++ )
     {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+        TTri* t1 = tri_vec[t];
+        vec3d* p1[3] = { &t1->m_N0->m_Pnt, &t1->m_N1->m_Pnt, &t1->m_N2->m_Pnt };
+
+        TBndBoxNode tn;
+        for ( int a = 0 ; a < 3 ; a++ )
+        {
+            tn.m_Min[a] = min( p1[0]->v[a], min( p1[1]->v[a], p1[2]->v[a] ) );
+            tn.m_Max[a] = max( p1[0]->v[a], max( p1[1]->v[a], p1[2]->v[a] ) );
+        }
 
-        if ( iFlag && tparm > 0.0 )
+        int num_stack = 0;
+        stack[ num_stack++ ] = 0;
+
+        while ( num_stack > 0 )
         {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+            const TBndBoxNode & n = m_NodeVec[ stack[ --num_stack ] ];
+
+            if ( !NodeOverlap( n, tn, 1.0e-12 ) )
             {
-                if ( fabs( tparm - tParmVec[j] ) < 0.0000001 )
-                {
-                    dupFlag = 1;
-                    break;
-                }
+                continue;
             }
 
-            if ( !dupFlag )
+            if ( n.m_NumTris == 0 )
             {
-                tParmVec.push_back( tparm );
+                stack[ num_stack++ ] = n.m_Start + 1;
+                stack[ num_stack++ ] = n.m_Start;
+                continue;
+            }
+
+            for ( int i = n.m_Start ; i < n.m_Start + n.m_NumTris ; i++ )
+            {
+                vec3d* p0 = &m_PntVec[ 3 * i ];
+
+                int iflag = tri_tri_intersect_with_isectline(
+                                p0[0].v, p0[1].v, p0[2].v,
+                                p1[0]->v, p1[1]->v, p1[2]->v,
+                                &coplanarFlag, e0.v, e1.v );
+
+                if ( iflag && !coplanarFlag && dist( e0, e1 ) > 0.000001 )
+                {
+                    TEdge* ie = new ( m_Arena ) TEdge();
+                    ie->m_N0 = new ( m_Arena ) TNode();
+                    ie->m_N0->m_Pnt = e0;
+                    ie->m_N1 = new ( m_Arena ) TNode();
+                    ie->m_N1->m_Pnt = e1;
+
+                    m_TriVec[i]->m_ISectEdgeVec.push_back( ie );
+                }
             }
         }
     }
-
 }
 
-void TBndBox::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
+void TBndBox::PlaneTris( const vec3d & org, const vec3d & norm, vector< TTri* > & tri_vec ) const
 {
-    int i, t;
-
-    if ( !m_Box.CheckPnt( p0.x(), p0.y(), p0.z() ) && !m_Box.CheckPnt( p1.x(), p1.y(), p1.z() ) )
+    if ( m_NodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    int stack[ 2 * MAX_DEPTH + 2 ];
+    int num_stack = 0;
+    stack[ num_stack++ ] = 0;
+
+    while ( num_stack > 0 )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBndBoxNode & n = m_NodeVec[ stack[ --num_stack ] ];
+
+        //==== Signed Distance Of Box Center And Projected Half Size ====//
+        double d = 0.0;
+        double r = 0.0;
+        for ( int a = 0 ; a < 3 ; a++ )
+        {
+            d += norm.v[a] * ( 0.5 * ( n.m_Min[a] + n.m_Max[a] ) - org.v[a] );
+            r += fabs( norm.v[a] ) * 0.5 * ( n.m_Max[a] - n.m_Min[a] );
+        }
+
+        if ( fabs( d ) > r + 1.0e-10 * ( r + fabs( d ) ) + 1.0e-12 )
+        {
+            continue;
+        }
+
+        if ( n.m_NumTris == 0 )
         {
-            m_SBoxVec[i]->SegIntersect( p0, p1, ipntVec );
+            stack[ num_stack++ ] = n.m_Start + 1;
+            stack[ num_stack++ ] = n.m_Start;
+            continue;
         }
+
+        for ( int i = n.m_Start ; i < n.m_Start + n.m_NumTris ; i++ )
+        {
+            const vec3d* p = &m_PntVec[ 3 * i ];
+            double d0 = dot( norm, p[0] - org );
+            double d1 = dot( norm, p[1] - org );
+            double d2 = dot( norm, p[2] - org );
+            double dmin = min( d0, min( d1, d2 ) );
+            double dmax = max( d0, max( d1, d2 ) );
+            double tol = 1.0e-10 * ( fabs( dmin ) + fabs( dmax ) ) + 1.0e-12;
+
+            if ( dmin <= tol && dmax >= -tol )
+            {
+                tri_vec.push_back( m_TriVec[i] );
+            }
+        }
+    }
+}
+
+void  TBndBox::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
+{
+    if ( m_NodeVec.empty() )
+    {
         return;
     }
 
-    //==== Check All Tris In Box ====//
+    int stack[ 2 * MAX_DEPTH + 2 ];
+    int num_stack = 0;
+    stack[ num_stack++ ] = 0;
+
     double tparm, uparm, vparm;
-    for ( t = 0 ; t < ( int )m_TriVec.size() ; t++ )
+    vec3d dir( 1.0, 0.0, 0.0 );
+
+    while ( num_stack > 0 )
     {
-        TTri* tri = m_TriVec[t];
-        vec3d n0pnt  = tri->m_N0->m_Pnt;
-        vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d p10    = p1 - p0;
-        if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
-                                p0, p10, uparm, vparm, tparm ) )
+        const TBndBoxNode & n = m_NodeVec[ stack[ --num_stack ] ];
+
+        if ( orig.y() < n.m_Min[1] || orig.y() > n.m_Max[1] ||
+             orig.z() < n.m_Min[2] || orig.z() > n.m_Max[2] )
         {
-            vec3d pnt = p0 + ( p1 - p0 ) * tparm;
-            ipntVec.push_back( pnt );
+            continue;
         }
-    }
 
-}
+        if ( n.m_NumTris == 0 )
+        {
+            stack[ num_stack++ ] = n.m_Start + 1;
+            stack[ num_stack++ ] = n.m_Start;
+            continue;
+        }
 
+        //==== Check All Tris In Leaf ====//
+        for ( int i = n.m_Start ; i < n.m_Start + n.m_NumTris ; i++ )
+        {
+            vec3d* p = &m_PntVec[ 3 * i ];
+            int iFlag = intersect_triangle( orig.v, dir.v, p[0].v, p[1].v, p[2].v, &tparm, &uparm, &vparm );
 
-//===============================================//
-//===============================================//
-//===============================================//
-//===============================================//
-//                  NBndBox
-//===============================================//
-//===============================================//
-//===============================================//
-//===============================================//
-NBndBox::NBndBox()
-{
-    for ( int i = 0 ; i < 8 ; i++ )
-    {
-        m_SBoxVec[i] = 0;
+            if ( iFlag && tparm > 0.0 )
+            {
+                AddUniqueTParm( tparm, tParmVec );
+            }
+        }
     }
 }
 
-NBndBox::~NBndBox()
+void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
 {
-    for ( int i = 0 ; i < 8 ; i++ )
+    if ( m_NodeVec.empty() )
     {
-        delete m_SBoxVec[i];
+        return;
     }
-}
 
-//==== Create Oct Tree of Overlaping BndBoxes ====//
-void NBndBox::SplitBox( double maxSize )
-{
-    int i;
-    if ( m_NodeVec.size() > 64 && m_Box.DiagDist() > maxSize  )
+    int stack[ 2 * MAX_DEPTH + 2 ];
+    int num_stack = 0;
+    stack[ num_stack++ ] = 0;
+
+    double coord[3];
+    double tparm, uparm, vparm;
+
+    while ( num_stack > 0 )
     {
-        //==== Find Split Points ====//
-        double hx = 0.5 * ( m_Box.GetMax( 0 ) + m_Box.GetMin( 0 ) );
-        double hy = 0.5 * ( m_Box.GetMax( 1 ) + m_Box.GetMin( 1 ) );
-        double hz = 0.5 * ( m_Box.GetMax( 2 ) + m_Box.GetMin( 2 ) );
+        const TBndBoxNode & n = m_NodeVec[ stack[ --num_stack ] ];
 
-        for ( i = 0 ; i < 8 ; i++ )
+        if ( !intersectRayAABB( n.m_Min, n.m_Max, orig.v, dir.v, coord ) )
         {
-            m_SBoxVec[i] = new NBndBox();
+            continue;
         }
 
-        for ( i = 0 ; i < ( int )m_NodeVec.size() ; i++ )
+        if ( n.m_NumTris == 0 )
         {
-            int cnt = 0;
-            if ( m_NodeVec[i]->m_Pnt.x() > hx )
-            {
-                cnt += 1;
-            }
-            if ( m_NodeVec[i]->m_Pnt.y() > hy )
-            {
-                cnt += 2;
-            }
-            if ( m_NodeVec[i]->m_Pnt.z() > hz )
-            {
-                cnt += 4;
-            }
-            m_SBoxVec[cnt]->AddNode( m_NodeVec[i] );
+            stack[ num_stack++ ] = n.m_Start + 1;
+            stack[ num_stack++ ] = n.m_Start;
+            continue;
         }
 
-        int contSplitFlag = 1;
-        /* Not Needed for Nodes ???
-                for ( i = 0 ; i < 8 ; i++ )
-                {
-                    if ( triVec.size() == sBoxVec[i]->triVec.size() )
-                    {
-                        contSplitFlag = 0;
-                        break;
-                    }
-                }
-        */
-        if ( contSplitFlag )
+        //==== Check All Tris In Leaf ====//
+        for ( int i = n.m_Start ; i < n.m_Start + n.m_NumTris ; i++ )
         {
-            for ( i = 0 ; i < 8 ; i++ )
+            vec3d* p = &m_PntVec[ 3 * i ];
+            int iFlag = intersect_triangle( orig.v, dir.v, p[0].v, p[1].v, p[2].v, &tparm, &uparm, &vparm );
+
+            if ( iFlag && tparm > 0.0 )
             {
-                m_SBoxVec[i]->SplitBox( maxSize );
+                AddUniqueTParm( tparm, tParmVec );
             }
         }
     }
 }
 
-void NBndBox::AddNode( TNode* n )
+void TBndBox::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
 {
-    m_NodeVec.push_back( n );
-    m_Box.Update( n->m_Pnt );
-}
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
 
-void NBndBox::AddLeafNodes( vector< NBndBox* > & leafVec )
-{
-    int i;
+    TBndBoxNode seg_node;
+    for ( int a = 0 ; a < 3 ; a++ )
+    {
+        seg_node.m_Min[a] = min( p0[a], p1[a] );
+        seg_node.m_Max[a] = max( p0[a], p1[a] );
+    }
+
+    int stack[ 2 * MAX_DEPTH + 2 ];
+    int num_stack = 0;
+    stack[ num_stack++ ] = 0;
+
+    double tparm, uparm, vparm;
+    vec3d p10 = p1 - p0;
 
-    if ( m_SBoxVec[0] )     // Keep Moving Down
+    while ( num_stack > 0 )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBndBoxNode & n = m_NodeVec[ stack[ --num_stack ] ];
+
+        if ( !NodeOverlap( n, seg_node, 1.0e-12 ) )
         {
-            m_SBoxVec[i]->AddLeafNodes( leafVec );
+            continue;
         }
-    }
-    else
-    {
-        if ( m_NodeVec.size() )
+
+        if ( n.m_NumTris == 0 )
         {
-            leafVec.push_back( this );
+            stack[ num_stack++ ] = n.m_Start + 1;
+            stack[ num_stack++ ] = n.m_Start;
+            continue;
+        }
+
+        //==== Check All Tris In Leaf ====//
+        for ( int t = n.m_Start ; t < n.m_Start + n.m_NumTris ; t++ )
+        {
+            vec3d* p = &m_PntVec[ 3 * t ];
+            vec3d n0pnt  = p[0];
+            vec3d n10pnt = p[1] - p[0];
+            vec3d n20pnt = p[2] - p[0];
+            if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
+                                    p0, p10, uparm, vparm, tparm ) )
+            {
+                vec3d pnt = p0 + ( p1 - p0 ) * tparm;
+                ipntVec.push_back( pnt );
+            }
         }
     }
+
 }
 
+
 //===============================================//
 //===============================================//
 //===============================================//
@@ -3087,7 +3722,7 @@ void TMesh::BuildEdgeMaps()
     // Build Perimeter Edges of Each Tri and push back tri onto master nodes
     for ( int t = 0 ; t < ( int )m_TVec.size(); t++ )
     {
-        m_TVec[t]->BuildPermEdges();
+        m_TVec[t]->BuildPermEdges( &m_Arena );
         m_NSMMap[m_TVec[t]->m_N0]->m_TriVec.push_back( m_TVec[t] );
         m_NSMMap[m_TVec[t]->m_N1]->m_TriVec.push_back( m_TVec[t] );
         m_NSMMap[m_TVec[t]->m_N2]->m_TriVec.push_back( m_TVec[t] );
@@ -3170,66 +3805,130 @@ void TMesh::BuildNodeMaps()
     // This method builds the map between a node and its aliases and a map between
     // each node to its master node
 
-    int i, n;
-
-    map< TNode*, list<TNode*> >::iterator mi;
-
     double tol = 1.0e-12;
-    double sqtol = sqrt( tol );
+    int num_nodes = ( int )m_NVec.size();
 
-    for ( n = 0 ; n < ( int )m_NVec.size() ; n++ )
-    {
-        m_NVec[n]->m_MergeVec.clear();
-    }
+    vector< vec3d* > pnt_vec( num_nodes );
 
-    NBndBox nBox;
-    for ( n = 0 ; n < ( int )m_NVec.size() ; n++ )
+    #pragma omp parallel for
+    for ( int n = 0 ; n < num_nodes ; n++ )
     {
-        nBox.AddNode( m_NVec[n] );
+        m_NVec[n]->m_MergeVec.clear();
+        pnt_vec[n] = &m_NVec[n]->m_Pnt;
     }
-    nBox.SplitBox( sqrt( tol ) );
 
-    //==== Find All Leaves of Oct Tree ====//
-    vector< NBndBox* > leafVec;
-    nBox.AddLeafNodes( leafVec );
+    //==== Grid Matches Within sqrt( tol ) Per Coordinate - Superset Of Alias Nodes ====//
+    PntHash pnt_hash;
+    pnt_hash.BuildGrid( pnt_vec, sqrt( tol ) );
 
-    for ( i = 0 ; i < ( int )leafVec.size() ; i++ )
-    {
-        leafVec[i]->m_Box.Expand( sqtol );
-    }
+    //==== Count Then Fill So Each Node's Close Nodes Are Contiguous ====//
+    vector< int > close_start_vec( num_nodes + 1, 0 );
+    vector< int > close_vec;
 
-    for ( n = 0 ; n < ( int )m_NVec.size() ; n++ )
+    for ( int pass = 0 ; pass < 2 ; pass++ )
     {
-        if ( m_NSMMap.find( m_NVec[n] ) == m_NSMMap.end() ) // This node doesn't have a master so continue
+        #pragma omp parallel
         {
-            for ( i = 0 ; i < ( int )leafVec.size() ; i++ )
+            vector< int > match_vec;
+
+            #pragma omp for schedule( dynamic, 4096 )
+            for ( int n = 0 ; n < num_nodes ; n++ )
             {
+                pnt_hash.FindAllMatches( m_NVec[n]->m_Pnt, match_vec );
 
-                if ( leafVec[i]->m_Box.CheckPnt( m_NVec[n]->m_Pnt.x(), m_NVec[n]->m_Pnt.y(), m_NVec[n]->m_Pnt.z() ) )
+                int cnt = 0;
+                for ( int i = 0 ; i < ( int )match_vec.size() ; i++ )
                 {
-                    for ( int m = 0 ; m < ( int )leafVec[i]->m_NodeVec.size() ; m++ )
+                    TNode* m = m_NVec[ match_vec[i] ];
+                    if ( m != m_NVec[n] && dist_squared( m_NVec[n]->m_Pnt, m->m_Pnt ) < tol )
                     {
-                        if ( m_NVec[n] != leafVec[i]->m_NodeVec[m] ) // If it is the same node skip
+                        if ( pass == 1 )
                         {
-                            if ( dist_squared( m_NVec[n]->m_Pnt, leafVec[i]->m_NodeVec[m]->m_Pnt ) < tol )
-                            {
-                                m_NVec[n]->m_MergeVec.push_back( leafVec[i]->m_NodeVec[m] );
-                                m_NAMap[m_NVec[n]].push_back( leafVec[i]->m_NodeVec[m] ); // Add node m to n's list of aliases
-                                m_NSMMap[leafVec[i]->m_NodeVec[m]] = m_NVec[n]; // Set m's master to be n
-                            }
+                            close_vec[ close_start_vec[n] + cnt ] = match_vec[i];
                         }
+                        cnt++;
                     }
                 }
+
+                if ( pass == 0 )
+                {
+                    close_start_vec[ n + 1 ] = cnt;
+                }
+            }
+        }
+
+        if ( pass == 0 )
+        {
+            for ( int n = 0 ; n < num_nodes ; n++ )
+            {
+                close_start_vec[ n + 1 ] += close_start_vec[n];
+            }
+            close_vec.resize( close_start_vec[ num_nodes ] );
+        }
+    }
+
+    //==== Whether A Node Is A Master Depends On Earlier Nodes - Assign In Node Order ====//
+    const int PRIOR_MASTER = -2;
+    vector< int > master_vec( num_nodes, -1 );
+    if ( !m_NSMMap.empty() )
+    {
+        #pragma omp parallel for
+        for ( int n = 0 ; n < num_nodes ; n++ )
+        {
+            if ( m_NSMMap.find( m_NVec[n] ) != m_NSMMap.end() )
+            {
+                master_vec[n] = PRIOR_MASTER;
+            }
+        }
+    }
+
+    vector< int > new_master_vec;
+    for ( int n = 0 ; n < num_nodes ; n++ )
+    {
+        if ( master_vec[n] == -1 ) // This node doesn't have a master so continue
+        {
+            for ( int i = close_start_vec[n] ; i < close_start_vec[ n + 1 ] ; i++ )
+            {
+                master_vec[ close_vec[i] ] = n; // Set m's master to be n
             }
 
             // Set n to be its own master
-            m_NSMMap[ m_NVec[n] ] = m_NVec[n];
+            master_vec[n] = n;
+            new_master_vec.push_back( n );
+        }
+    }
 
-            // Add n to its own set of aliases
-            m_NAMap[ m_NVec[n] ].push_front( m_NVec[n] );
+    m_NSMMap.reserve( m_NSMMap.size() + num_nodes );
+    for ( int n = 0 ; n < num_nodes ; n++ )
+    {
+        if ( master_vec[n] >= 0 )
+        {
+            m_NSMMap[ m_NVec[n] ] = m_NVec[ master_vec[n] ];
         }
     }
 
+    //==== Alias Lists In Map Order - Inserts At End Are Constant Time ====//
+    std::sort( new_master_vec.begin(), new_master_vec.end(), [&]( int a, int b )
+    {
+        return m_NVec[a] < m_NVec[b];
+    } );
+
+    for ( int k = 0 ; k < ( int )new_master_vec.size() ; k++ )
+    {
+        int n = new_master_vec[k];
+
+        map< TNode*, list<TNode*> >::iterator mi = m_NAMap.insert( m_NAMap.end(), make_pair( m_NVec[n], list<TNode*>() ) );
+
+        // Add n to its own set of aliases
+        mi->second.push_front( m_NVec[n] );
+
+        for ( int i = close_start_vec[n] ; i < close_start_vec[ n + 1 ] ; i++ )
+        {
+            TNode* m = m_NVec[ close_vec[i] ];
+            m_NVec[n]->m_MergeVec.push_back( m );
+            mi->second.push_back( m ); // Add node m to n's list of aliases
+        }
+    }
 }
 
 void TMesh::DeleteDupNodes()
@@ -3248,11 +3947,12 @@ void TMesh::DeleteDupNodes()
     list< TNode* >::iterator lit;
 
     //==== Go Thru All Tri And Set All Nodes to their Master ====//
+    #pragma omp parallel for
     for ( t = 0 ; t < (int)m_TVec.size(); t++ )
     {
-        m_TVec[t]->m_N0 = m_NSMMap[m_TVec[t]->m_N0];
-        m_TVec[t]->m_N1 = m_NSMMap[m_TVec[t]->m_N1];
-        m_TVec[t]->m_N2 = m_NSMMap[m_TVec[t]->m_N2];
+        m_TVec[t]->m_N0 = GetMasterNode( m_TVec[t]->m_N0 );
+        m_TVec[t]->m_N1 = GetMasterNode( m_TVec[t]->m_N1 );
+        m_TVec[t]->m_N2 = GetMasterNode( m_TVec[t]->m_N2 );
     }
 
     //==== Nuke Degenerate Tris ====//
@@ -3304,6 +4004,17 @@ void TMesh::DeleteDupNodes()
 
 }
 
+//==== Master Of n From Node Maps - NULL If n Was Not Mapped ====//
+TNode* TMesh::GetMasterNode( TNode* n ) const
+{
+    unordered_map< TNode*, TNode* >::const_iterator iter = m_NSMMap.find( n );
+    if ( iter == m_NSMMap.end() )
+    {
+        return NULL;
+    }
+    return iter->second;
+}
+
 void TMesh::MatchNodes()
 {
     BuildMergeMaps();
@@ -3871,9 +4582,9 @@ void TMesh::SplitAliasEdges( TTri* orig_tri, TEdge* isect_edge )
                     }
 
                     // Create Fake Edge
-                    TEdge* n_edge = new TEdge();
-                    n_edge->m_N0 = new TNode();
-                    n_edge->m_N1 = new TNode();
+                    TEdge* n_edge = new ( &m_Arena ) TEdge();
+                    n_edge->m_N0 = new ( &m_Arena ) TNode();
+                    n_edge->m_N1 = new ( &m_Arena ) TNode();
                     n_edge->SetParTri( ta );
                     n_edge->m_N0->SetUWPnt( uwn );
                     n_edge->m_N0->SetXYZPnt( *nn );
@@ -3895,27 +4606,29 @@ void TMesh::SubTag( int part_num, bool tag_subs )
     // Split tris will be subtagged the same as their parent
     vector<SubSurface*> sub_surfs;
     if ( tag_subs ) sub_surfs = SubSurfaceMgr.GetSubSurfs( m_PtrID, m_SurfNum );
-    int ss_num = ( int )sub_surfs.size();
 
-    for ( int t = 0 ; t < ( int )m_TVec.size(); t ++ )
+    SubSurfTagGrid tag_grid;
+    tag_grid.Build( sub_surfs );
+
+    // Tris are tagged independently
+    int ntri = ( int )m_TVec.size();
+    #pragma omp parallel for
+    for ( int t = 0 ; t < ntri ; t ++ )
     {
         TTri* tri = m_TVec[t];
         tri->m_Tags.push_back( part_num ); // Give Tri overall surface ID number
-        for ( int s = 0; s < ss_num; s++ )
-        {
-            if ( sub_surfs[s]->Subtag( tri ) )
-            {
-                tri->m_Tags.push_back( sub_surfs[s]->m_Tag );
-            }
-        }
-
-        SubSurfaceMgr.m_TagCombos.insert( tri->m_Tags );
+        tag_grid.Subtag( tri->ComputeCenterUW(), tri->m_Tags );
 
         for ( int st = 0; st < ( int )tri->m_SplitVec.size() ; st++ ) // Set split tris to have same tags as main tri
         {
             tri->m_SplitVec[st]->m_Tags = tri->m_Tags;
         }
     }
+
+    for ( int t = 0 ; t < ntri ; t ++ )
+    {
+        SubSurfaceMgr.m_TagCombos.insert( m_TVec[t]->m_Tags );
+    }
 }
 
 vec3d TMesh::CompPnt( const vec3d & uw_pnt )
@@ -24,11 +24,13 @@
 #include "BndBox.h"
 #include "DragFactors.h"
 #include "XmlUtil.h"
+#include "TMeshArena.h"
 
 #include <vector>               //jrg windows?? 
 #include <algorithm>            //jrg windows??
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <list>
 using namespace std;            //jrg windows??
 
@@ -41,8 +43,8 @@ extern "C"
 class TEdge;
 class TTri;
 class TBndBox;
-class NBndBox;
 class TMesh;
+class WriteBuffer;
 
 class TetraMassProp
 {
@@ -164,7 +166,7 @@ public:
 //============================================== END DegenGeom ==============================================//
 //===========================================================================================================//
 
-class TNode
+class TNode : public TMeshArenaObj
 {
 public:
     /*
@@ -220,7 +222,7 @@ protected:
     int m_CoordInfo;
 };
 
-class TEdge
+class TEdge : public TMeshArenaObj
 {
 public:
     TEdge();
@@ -250,7 +252,7 @@ protected:
 
 
 
-class TTri
+class TTri : public TMeshArenaObj
 {
 public:
     TTri();
@@ -268,9 +270,10 @@ public:
     vector< TEdge* > m_EVec;                // Edges for split tris
     TEdge* m_PEArr[3];                          // Perimeter Edge Array
 
-    virtual void CopyFrom( const TTri* tri );
-    virtual void SplitTri();              // Split Tri to Fit ISect Edges
-    virtual void TriangulateSplit( int flattenAxis );
+    //==== New Nodes, Edges and Split Tris Are Placed In arena (Heap If NULL) ====//
+    virtual void CopyFrom( const TTri* tri, TMeshArena* arena = NULL );
+    virtual void SplitTri( TMeshArena* arena = NULL );          // Split Tri to Fit ISect Edges
+    virtual void TriangulateSplit( int flattenAxis, const vector< vec3d > & flatPntVec, TMeshArena* arena = NULL );
     virtual vec3d ComputeCenter()
     {
         return ( m_N0->m_Pnt + m_N1->m_Pnt + m_N2->m_Pnt ) / 3.0;
@@ -320,7 +323,7 @@ public:
         return m_TMesh;
     }
 
-    virtual void BuildPermEdges();
+    virtual void BuildPermEdges( TMeshArena* arena = NULL );
 
     virtual int OnEdge( vec3d & p, TEdge* e, double onEdgeTol, double * t = NULL );
     virtual vec3d CompPnt( const vec3d & uw_pnt );
@@ -344,6 +347,16 @@ private:
 
 };
 
+//==== Flattened BVH Node - Leaf If m_NumTris > 0, Else Children m_Start and m_Start + 1 ====//
+struct TBndBoxNode
+{
+    double m_Min[3];
+    double m_Max[3];
+    int m_Start;            // First Tri (Leaf) or First Child
+    int m_NumTris;
+};
+
+//==== Triangle BVH - Binned SAH Split, Nodes and Tri Vertices Stored Contiguously ====//
 class TBndBox
 {
 public:
@@ -353,37 +366,54 @@ public:
     virtual void Reset();
 
     BndBox m_Box;
-    vector< TTri* > m_TriVec;
+    vector< TTri* > m_TriVec;   // Tree Order After SplitBox
 
-    TBndBox* m_SBoxVec[8];      // Split Bnd Boxes
-
-    void SplitBox();
+    void SplitBox();            // Build Tree - Tri Nodes Must Not Move Until Reset
     void AddTri( TTri* t );
     virtual void Intersect( TBndBox* iBox, bool UWFlag = false );
+    //==== Intersect Tris Outside Any Box - Edges Are Added To This Box's Tris Only ====//
+    virtual void IntersectTris( const vector< TTri* > & tri_vec );
+    //==== Append Tris That May Cross Plane Through org - Read Only So Safe To Share ====//
+    virtual void PlaneTris( const vec3d & org, const vec3d & norm, vector< TTri* > & tri_vec ) const;
     virtual void NumCrossXRay( vec3d & orig, vector<double> & tParmVec );
     virtual void RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec );
-    virtual void AddLeafNodes( vector< TBndBox* > & leafVec );
 
     virtual void SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec );
     virtual bool CheckIntersect( TBndBox* iBox );
     virtual double MinDistance( TBndBox* iBox, double curr_min_dist );
 
-};
+    int GetNumNodes() const
+    {
+        return ( int )m_NodeVec.size();
+    }
 
-class NBndBox
-{
-public:
-    NBndBox();
-    virtual ~NBndBox();
+    //==== Intersection Edges Added To This Box's Tris Are Placed In arena ====//
+    void SetArena( TMeshArena* arena )
+    {
+        m_Arena = arena;
+    }
 
-    BndBox m_Box;
-    vector< TNode* > m_NodeVec;
+protected:
+
+    enum { MAX_LEAF_TRIS = 8, MAX_DEPTH = 48, NUM_SAH_BINS = 16, PARALLEL_BUILD_TRIS = 4096 };
+
+    //==== Build Into m_BuildNodeVec - Left Child At node + 1, Right At node + 2 * NumLeft ====//
+    void BuildNode( int node, int start, int num, int depth );
+    void FlattenNode( int node, int flat );
+
+    //==== Leaf Pairs Whose Boxes Overlap (Compare With tol) ====//
+    void FindLeafPairs( TBndBox* iBox, vector< pair< int, int > > & leaf_pair_vec, double tol = 1.0e-12 );
 
-    NBndBox* m_SBoxVec[8];      // Split Bnd Boxes
+    vector< TBndBoxNode > m_NodeVec;        // Root At 0, Siblings Adjacent
+    vector< vec3d > m_PntVec;               // 3 Per Tri, Same Order As m_TriVec
 
-    void SplitBox( double maxSize );
-    void AddNode( TNode* n );
-    virtual void AddLeafNodes( vector< NBndBox* > & leafVec );
+    //==== Build Scratch ====//
+    vector< double > m_TriBndVec;           // Min XYZ, Max XYZ Per Tri
+    vector< double > m_CenterVec;           // XYZ Per Tri
+    vector< int > m_IndVec;
+    vector< TBndBoxNode > m_BuildNodeVec;
+
+    TMeshArena* m_Arena;
 
 };
 
@@ -395,18 +425,29 @@ public:
     TMesh();
     virtual ~TMesh();
 
+    //==== Normal, 3 Vertices and Attribute Count ====//
+    enum { BIN_STL_FACET_SIZE = 50 };
+
+    //==== Layout Of Tri_Data Blob Written By EncodeTriData ====//
+    enum { TRI_DATA_VERSION = 1 };
+
     vector< TTri* >  m_TVec;
     vector< TNode* > m_NVec;
     vector< TEdge* > m_EVec;
 
+    //==== Storage For Tris, Nodes and Edges Created By This Mesh - Released With It ====//
+    TMeshArena m_Arena;
+
     TBndBox m_TBox;
 
     void copy( TMesh* m );
     void CopyFlatten( TMesh* m );
-    virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
+    virtual xmlNodePtr EncodeXml( xmlNodePtr & node, bool binary_flag = false );
     virtual void DecodeXml( xmlNodePtr & node );
     virtual xmlNodePtr EncodeTriList( xmlNodePtr & node );
     virtual void DecodeTriList( xmlNodePtr & node, int num_tris );
+    virtual xmlNodePtr EncodeTriData( xmlNodePtr & node );
+    virtual bool DecodeTriData( xmlNodePtr & node );
 
     //==== Stuff Copied From Geom That Created This Mesh ====//
     string m_PtrID;
@@ -435,12 +476,14 @@ public:
     bool CheckIntersect( TMesh* tm );
     double MinDistance( TMesh* tm, double curr_min_dist );
     void Split();
+    //==== Tris Are Classified In Parallel - tParmVec Is A Reused Hit Buffer ====//
     void DeterIntExt( vector< TMesh* >& meshVec );
-    void DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
+    void DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec, vector< double > & tParmVec );
     void MassDeterIntExt( vector< TMesh* >& meshVec );
-    void MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
+    void MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec, vector< double > & tParmVec );
     void WaveDeterIntExt( vector< TMesh* >& meshVec );
-    void WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
+    void WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec, vector< double > & tParmVec );
+    void LoadDeterIntExtTris( vector< TTri* > & tri_vec );
 
     void LoadBndBox();
 
@@ -457,7 +500,12 @@ public:
     virtual void AddTri( const TTri* tri );
     virtual void AddUWTri( const vec3d & uw0, const vec3d & uw1, const vec3d & uw2, const vec3d & norm );
 
+    virtual void FindSTLTris( vector< TTri* > & tri_vec );
     virtual void WriteSTLTris( FILE* file_id, Matrix4d XFormMat );
+    virtual int  WriteBinSTLTris( FILE* file_id, Matrix4d XFormMat );
+
+    static void WriteSTLFacet( WriteBuffer & buf, const vec3d & norm, const vec3d & v0, const vec3d & v1, const vec3d & v2 );
+    static void WriteBinSTLFacet( WriteBuffer & buf, const vec3d & norm, const vec3d & v0, const vec3d & v1, const vec3d & v2 );
 
     virtual vec3d GetVertex( int index );
     virtual int   NumVerts();
@@ -476,6 +524,7 @@ public:
     virtual void BuildNodeMaps();
     virtual void BuildEdgeMaps();
     virtual void DeleteDupNodes();
+    TNode* GetMasterNode( TNode* n ) const;
 
     virtual void MatchNodes();
     virtual void CheckValid( FILE* fid );
@@ -510,7 +559,7 @@ protected:
     void CopyAttributes( TMesh* m );
 
     map< TNode*, list<TNode*> > m_NAMap; // Map from a master node to list of nodes that are aliases
-    map< TNode*, TNode* > m_NSMMap;      // Map of node slave to master node
+    unordered_map< TNode*, TNode* > m_NSMMap; // Map of node slave to master node
     map< TEdge*, vector<TEdge*> > m_EAMap; // Map from a master edge to a list of edges that are aliases
     map< TEdge*, TEdge* > m_ESMMap;      // Map from edge slave to master edge
 
@@ -0,0 +1,344 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// TMeshArena.cpp: Block storage for the nodes, edges and tris owned by one TMesh.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "TMeshArena.h"
+#include "ParallelUtil.h"
+
+#include <atomic>
+#include <new>
+
+static std::atomic< long long > s_NumHeapAlloc( 0 );
+static std::atomic< long long > s_NumArenaAlloc( 0 );
+static std::atomic< long long > s_NumArenaReuse( 0 );
+static std::atomic< long long > s_NumArenaBlocks( 0 );
+
+//===============================================//
+//                  TMeshArena
+//===============================================//
+TMeshArena::TMeshArena()
+{
+    m_ThreadVec.resize( GetMaxNumThreads() );
+    for ( int i = 0 ; i < ( int )m_ThreadVec.size() ; i++ )
+    {
+        m_ThreadVec[i].m_NumUsed = BLOCK_SIZE;
+        m_ThreadVec[i].m_NumAlloc = 0;
+        m_ThreadVec[i].m_NumReuse = 0;
+    }
+    m_SharedFreeFlag = false;
+}
+
+TMeshArena::~TMeshArena()
+{
+    Release();
+}
+
+void* TMeshArena::Alloc( size_t size )
+{
+    //==== Inner Regions Reuse Thread Numbers Of The Outer Region ====//
+    if ( GetParallelLevel() > 1 )
+    {
+        return NULL;
+    }
+
+    int ithread = GetThreadNum();
+    if ( ithread >= ( int )m_ThreadVec.size() )
+    {
+        return NULL;
+    }
+
+    size = ( size + ALIGN_SIZE - 1 ) & ~( ( size_t )ALIGN_SIZE - 1 );
+    if ( size > BLOCK_SIZE )
+    {
+        return NULL;
+    }
+
+    ThreadBlocks & tb = m_ThreadVec[ ithread ];
+
+    //==== Deleted Slots First - Inside A Parallel Region The First Thread To ====//
+    //==== Run Dry Takes All Shared Slots, So The Lock Is Taken Once At Most  ====//
+    void* mem = PopFree( tb.m_FreeVec, size );
+    if ( !mem && m_SharedFreeFlag )
+    {
+        if ( GetParallelLevel() == 0 )
+        {
+            mem = PopFree( m_SharedFreeVec, size );
+        }
+        else
+        {
+            std::lock_guard< std::mutex > lock( m_SharedFreeMutex );
+            for ( int i = 0 ; i < ( int )m_SharedFreeVec.size() ; i++ )
+            {
+                FreeList* fl = FindFreeList( tb.m_FreeVec, m_SharedFreeVec[i].m_Size, true );
+                char* tail = m_SharedFreeVec[i].m_Head;
+                while ( tail && *reinterpret_cast< char** >( tail ) )
+                {
+                    tail = *reinterpret_cast< char** >( tail );
+                }
+                if ( tail )
+                {
+                    *reinterpret_cast< char** >( tail ) = fl->m_Head;
+                    fl->m_Head = m_SharedFreeVec[i].m_Head;
+                }
+            }
+            m_SharedFreeVec.clear();
+            m_SharedFreeFlag = false;
+
+            mem = PopFree( tb.m_FreeVec, size );
+        }
+    }
+    if ( mem )
+    {
+        tb.m_NumAlloc++;
+        tb.m_NumReuse++;
+        return mem;
+    }
+
+    if ( tb.m_NumUsed + size > BLOCK_SIZE )
+    {
+        tb.m_BlockVec.push_back( static_cast< char* >( ::operator new( BLOCK_SIZE ) ) );
+        tb.m_NumUsed = 0;
+    }
+
+    mem = tb.m_BlockVec.back() + tb.m_NumUsed;
+    tb.m_NumUsed += size;
+    tb.m_NumAlloc++;
+
+    return mem;
+}
+
+bool TMeshArena::Free( void* mem, size_t size )
+{
+    int level = GetParallelLevel();
+    if ( level > 1 )
+    {
+        return false;
+    }
+
+    size = ( size + ALIGN_SIZE - 1 ) & ~( ( size_t )ALIGN_SIZE - 1 );
+
+    vector< FreeList > * free_vec = &m_SharedFreeVec;
+    if ( level == 1 )
+    {
+        int ithread = GetThreadNum();
+        if ( ithread >= ( int )m_ThreadVec.size() )
+        {
+            return false;
+        }
+        free_vec = &m_ThreadVec[ ithread ].m_FreeVec;
+    }
+
+    FreeList* fl = FindFreeList( *free_vec, size, true );
+    *reinterpret_cast< char** >( mem ) = fl->m_Head;
+    fl->m_Head = static_cast< char* >( mem );
+
+    if ( level == 0 )
+    {
+        m_SharedFreeFlag = true;
+    }
+    return true;
+}
+
+TMeshArena::FreeList* TMeshArena::FindFreeList( vector< FreeList > & free_vec, size_t size, bool add_flag )
+{
+    //==== Only A Few Object Sizes Are Ever Placed Here ====//
+    for ( int i = 0 ; i < ( int )free_vec.size() ; i++ )
+    {
+        if ( free_vec[i].m_Size == size )
+        {
+            return &free_vec[i];
+        }
+    }
+
+    if ( !add_flag )
+    {
+        return NULL;
+    }
+
+    FreeList fl;
+    fl.m_Size = size;
+    fl.m_Head = NULL;
+    free_vec.push_back( fl );
+    return &free_vec.back();
+}
+
+void* TMeshArena::PopFree( vector< FreeList > & free_vec, size_t size )
+{
+    FreeList* fl = FindFreeList( free_vec, size, false );
+    if ( !fl || !fl->m_Head )
+    {
+        return NULL;
+    }
+
+    char* mem = fl->m_Head;
+    fl->m_Head = *reinterpret_cast< char** >( mem );
+    return mem;
+}
+
+void TMeshArena::Release()
+{
+    s_NumArenaAlloc += GetNumAlloc();
+    s_NumArenaReuse += GetNumReuse();
+    s_NumArenaBlocks += GetNumBlocks();
+
+    for ( int i = 0 ; i < ( int )m_ThreadVec.size() ; i++ )
+    {
+        ThreadBlocks & tb = m_ThreadVec[i];
+        for ( int b = 0 ; b < ( int )tb.m_BlockVec.size() ; b++ )
+        {
+            ::operator delete( tb.m_BlockVec[b] );
+        }
+        tb.m_BlockVec.clear();
+        tb.m_FreeVec.clear();
+        tb.m_NumUsed = BLOCK_SIZE;
+        tb.m_NumAlloc = 0;
+        tb.m_NumReuse = 0;
+    }
+    m_SharedFreeVec.clear();
+    m_SharedFreeFlag = false;
+}
+
+int TMeshArena::GetNumAlloc() const
+{
+    int num = 0;
+    for ( int i = 0 ; i < ( int )m_ThreadVec.size() ; i++ )
+    {
+        num += m_ThreadVec[i].m_NumAlloc;
+    }
+    return num;
+}
+
+int TMeshArena::GetNumReuse() const
+{
+    int num = 0;
+    for ( int i = 0 ; i < ( int )m_ThreadVec.size() ; i++ )
+    {
+        num += m_ThreadVec[i].m_NumReuse;
+    }
+    return num;
+}
+
+int TMeshArena::GetNumBlocks() const
+{
+    int num = 0;
+    for ( int i = 0 ; i < ( int )m_ThreadVec.size() ; i++ )
+    {
+        num += ( int )m_ThreadVec[i].m_BlockVec.size();
+    }
+    return num;
+}
+
+size_t TMeshArena::GetMemorySize() const
+{
+    return ( size_t )GetNumBlocks() * BLOCK_SIZE;
+}
+
+size_t TMeshArena::GetFreeSize() const
+{
+    size_t num = 0;
+    for ( int i = -1 ; i < ( int )m_ThreadVec.size() ; i++ )
+    {
+        const vector< FreeList > & free_vec = ( i < 0 ) ? m_SharedFreeVec : m_ThreadVec[i].m_FreeVec;
+        for ( int f = 0 ; f < ( int )free_vec.size() ; f++ )
+        {
+            for ( char* mem = free_vec[f].m_Head ; mem ; mem = *reinterpret_cast< char** >( mem ) )
+            {
+                num += free_vec[f].m_Size;
+            }
+        }
+    }
+    return num;
+}
+
+//===============================================//
+//                  TMeshArenaObj
+//===============================================//
+void* TMeshArenaObj::operator new( size_t size )
+{
+    char* mem = static_cast< char* >( ::operator new( size + HEADER_SIZE ) );
+    *reinterpret_cast< TMeshArena** >( mem ) = NULL;
+    s_NumHeapAlloc++;
+
+    return mem + HEADER_SIZE;
+}
+
+void* TMeshArenaObj::operator new( size_t size, TMeshArena* arena )
+{
+    char* mem = NULL;
+    if ( arena )
+    {
+        mem = static_cast< char* >( arena->Alloc( size + HEADER_SIZE ) );
+    }
+
+    if ( !mem )
+    {
+        return operator new( size );
+    }
+
+    *reinterpret_cast< TMeshArena** >( mem ) = arena;
+    return mem + HEADER_SIZE;
+}
+
+//==== size Is That Of The Dynamic Type - The Destructors Are Virtual ====//
+void TMeshArenaObj::operator delete( void* ptr, size_t size )
+{
+    if ( !ptr )
+    {
+        return;
+    }
+
+    //==== Arena Slots Are Reused By The Same Arena Or Returned By TMeshArena::Release ====//
+    char* mem = static_cast< char* >( ptr ) - HEADER_SIZE;
+    TMeshArena* arena = *reinterpret_cast< TMeshArena** >( mem );
+    if ( arena == NULL )
+    {
+        ::operator delete( mem );
+    }
+    else
+    {
+        arena->Free( mem, size + HEADER_SIZE );
+    }
+}
+
+//==== Only Called When A Constructor Throws - Arena Slot Is Left For Release ====//
+void TMeshArenaObj::operator delete( void* ptr, TMeshArena* arena )
+{
+    char* mem = static_cast< char* >( ptr ) - HEADER_SIZE;
+    if ( *reinterpret_cast< TMeshArena** >( mem ) == NULL )
+    {
+        ::operator delete( mem );
+    }
+}
+
+void TMeshArenaObj::ResetAllocCounts()
+{
+    s_NumHeapAlloc = 0;
+    s_NumArenaAlloc = 0;
+    s_NumArenaReuse = 0;
+    s_NumArenaBlocks = 0;
+}
+
+long long TMeshArenaObj::GetNumHeapAlloc()
+{
+    return s_NumHeapAlloc;
+}
+
+long long TMeshArenaObj::GetNumArenaAlloc()
+{
+    return s_NumArenaAlloc;
+}
+
+long long TMeshArenaObj::GetNumArenaReuse()
+{
+    return s_NumArenaReuse;
+}
+
+long long TMeshArenaObj::GetNumArenaBlocks()
+{
+    return s_NumArenaBlocks;
+}
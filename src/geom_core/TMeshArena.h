@@ -0,0 +1,111 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// TMeshArena.h: Block storage for the nodes, edges and tris owned by one TMesh.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(TMESH_ARENA__INCLUDED_)
+#define TMESH_ARENA__INCLUDED_
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////
+//==== Bump Allocator With One Block List Per Thread.  Deleted Slots Go On A ====//
+//==== Free List For Their Size and Are Handed Out Again Before Blocks Grow. ====//
+//==== Blocks Are Returned When The Arena Is Released, So Objects Placed     ====//
+//==== Here Must Not Outlive The Arena.                                      ====//
+class TMeshArena
+{
+public:
+
+    TMeshArena();
+    virtual ~TMeshArena();
+
+    //==== Returns NULL When Calling Thread Has No Block List (Nested Region) ====//
+    void* Alloc( size_t size );
+
+    //==== Put A Slot Of size Bytes Back - False If It Stays Unused Until Release ====//
+    bool Free( void* mem, size_t size );
+
+    //==== Free All Blocks - Objects Must Already Be Destructed ====//
+    void Release();
+
+    int GetNumAlloc() const;
+    int GetNumReuse() const;
+    int GetNumBlocks() const;
+
+    //==== Bytes Reserved By Blocks ====//
+    size_t GetMemorySize() const;
+
+    //==== Bytes Of Deleted Slots Waiting For Reuse ====//
+    size_t GetFreeSize() const;
+
+protected:
+
+    //==== Blocks Own Storage and Are Never Shared ====//
+    TMeshArena( const TMeshArena & );
+    TMeshArena & operator=( const TMeshArena & );
+
+    enum { BLOCK_SIZE = 256 * 1024, ALIGN_SIZE = 8 };
+
+    //==== Singly Linked Through The First Bytes Of Each Deleted Slot ====//
+    struct FreeList
+    {
+        size_t m_Size;
+        char* m_Head;
+    };
+
+    static FreeList* FindFreeList( vector< FreeList > & free_vec, size_t size, bool add_flag );
+    static void* PopFree( vector< FreeList > & free_vec, size_t size );
+
+    struct ThreadBlocks
+    {
+        vector< char* > m_BlockVec;
+        size_t m_NumUsed;                   // Bytes Used In Last Block
+        int m_NumAlloc;
+        int m_NumReuse;
+        vector< FreeList > m_FreeVec;       // Slots Deleted By This Thread Inside A Parallel Region
+        char m_Pad[ 64 ];                   // Keep Threads Off Each Others Cache Lines
+    };
+
+    vector< ThreadBlocks > m_ThreadVec;
+
+    //==== Slots Deleted Outside Parallel Regions - Any Thread Can Reuse Them ====//
+    vector< FreeList > m_SharedFreeVec;
+    std::atomic< bool > m_SharedFreeFlag;
+    std::mutex m_SharedFreeMutex;
+};
+
+//////////////////////////////////////////////////////////////////////
+//==== Base For TNode, TEdge and TTri - new ( arena ) T() Places The Object ====//
+//==== In arena, new T() Or A NULL arena Uses The Heap.  delete Works On Both ====//
+class TMeshArenaObj
+{
+public:
+
+    static void* operator new( size_t size );
+    static void* operator new( size_t size, TMeshArena* arena );
+    static void operator delete( void* ptr, size_t size );
+    static void operator delete( void* ptr, TMeshArena* arena );
+
+    //==== Process Wide Counts - Arena Counts Are Added When An Arena Is Released ====//
+    static void ResetAllocCounts();
+    static long long GetNumHeapAlloc();
+    static long long GetNumArenaAlloc();
+    static long long GetNumArenaReuse();
+    static long long GetNumArenaBlocks();
+
+protected:
+
+    //==== Owning Arena (NULL For Heap) Is Stored Just Before Each Object ====//
+    enum { HEADER_SIZE = 8 };
+};
+
+#endif
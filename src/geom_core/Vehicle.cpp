@@ -28,6 +28,7 @@
 #include "DXFUtil.h"
 #include "FitModelMgr.h"
 #include "FileUtil.h"
+#include "WriteBuffer.h"
 #include "VarPresetMgr.h"
 #include "VSPAEROMgr.h"
 #include "main.h"
@@ -64,6 +65,11 @@ Vehicle::Vehicle()
     m_4View4_rot.Init( "BottomRightRotation", "DXFSettings", this, vsp::ROT_0, vsp::ROT_0, vsp::ROT_270 );
 
     m_STLMultiSolid.Init( "MultiSolid", "STLSettings", this, false, 0, 1 );
+    m_STLBinary.Init( "Binary", "STLSettings", this, false, 0, 1 );
+    m_Cart3DBinary.Init( "Binary", "Cart3DSettings", this, false, 0, 1 );
+
+    m_BinaryMeshXml.Init( "BinaryMesh", "XMLSettings", this, false, 0, 1 );
+    m_BinaryMeshXml.SetDescript( "Save mesh and point cloud geometry as compressed binary data" );
 
     m_UpdatingBBox = false;
     m_BbXLen.Init( "X_Len", "BBox", this, 0, 0, 1e12 );
@@ -189,6 +195,10 @@ void Vehicle::Init()
     m_4View4_rot.Set( vsp::ROT_0 );
 
     m_STLMultiSolid.Set( false );
+    m_STLBinary.Set( false );
+    m_Cart3DBinary.Set( false );
+
+    m_BinaryMeshXml.Set( false );
 
     m_BEMPropID = string();
 
@@ -258,6 +268,8 @@ void Vehicle::Wype()
 
     m_ExportFileNames.clear();
 
+    m_SnapTo.ClearOtherTMeshVec();
+
     // Clear out various managers...
     LinkMgr.Renew();
     AdvLinkMgr.Renew();
@@ -1599,6 +1611,73 @@ void Vehicle::WriteSTLFile( const string & file_name, int write_set )
     fclose( fid );
 }
 
+//==== Write Binary STL File ====//
+void Vehicle::WriteBinSTLFile( const string & file_name, int write_set )
+{
+    vector< Geom* > geom_vec = FindGeomVec( GetGeomVec( false ) );
+    if ( !geom_vec[0] )
+    {
+        return;
+    }
+
+    if ( !ExistMesh( write_set ) )
+    {
+        string mesh_id = AddMeshGeom( write_set );
+        if ( mesh_id.compare( "NONE" ) != 0 )
+        {
+            Geom* gPtr = FindGeom( mesh_id );
+            if ( gPtr )
+            {
+                geom_vec.push_back( gPtr );
+                gPtr->Update();
+            }
+            HideAllExcept( mesh_id );
+        }
+    }
+
+    FILE* fid = fopen( file_name.c_str(), "wb" );
+    if ( !fid )
+    {
+        return;
+    }
+
+    //==== 80 Byte Header Must Not Start With "solid" ====//
+    char header[80];
+    memset( header, ' ', sizeof( header ) );
+    string title = "Binary STL written by OpenVSP";
+    memcpy( header, title.c_str(), title.size() );
+    fwrite( header, 1, sizeof( header ), fid );
+
+    //==== Facet Count Is Filled In Once Degenerate Tris Are Skipped ====//
+    WriteBuffer count_buf;
+    count_buf.AppendBinInt( 0 );
+    count_buf.Write( fid );
+
+    int num_facet = 0;
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( geom_vec[i]->GetSetFlag( write_set ) && geom_vec[i]->GetType().m_Type == MESH_GEOM_TYPE )
+        {
+            num_facet += geom_vec[i]->WriteBinStl( fid );
+        }
+    }
+
+    count_buf.Clear();
+    count_buf.AppendBinInt( num_facet );
+    fseek( fid, sizeof( header ), SEEK_SET );
+    count_buf.Write( fid );
+
+    fclose( fid );
+}
+
+//==== Fortran Unformatted Record Length Marker ====//
+static void WriteBinRecordMarker( FILE* fid, int num_bytes )
+{
+    WriteBuffer buf;
+    buf.AppendBinInt( num_bytes, true );
+    buf.Write( fid );
+}
+
 //==== Write STL File ====//
 void Vehicle::WriteTaggedMSSTLFile( const string & file_name, int write_set )
 {
@@ -1693,7 +1772,7 @@ void Vehicle::WriteTRIFile( const string & file_name, int write_set )
     }
 
     //==== Open file ====//
-    FILE* file_id = fopen( file_name.c_str(), "w" );
+    FILE* file_id = fopen( file_name.c_str(), m_Cart3DBinary() ? "wb" : "w" );
 
     if ( !file_id )
     {
@@ -1718,6 +1797,14 @@ void Vehicle::WriteTRIFile( const string & file_name, int write_set )
         }
     }
 
+    if ( m_Cart3DBinary() )
+    {
+        WriteBinTRIRecords( file_id, geom_vec, write_set, num_pnts, num_tris );
+        fclose( file_id );
+        SubSurfaceMgr.WriteKeyFile( file_name );
+        return;
+    }
+
     fprintf( file_id, "%d %d\n", num_pnts, num_tris );
 
     //==== Dump Points ====//
@@ -1761,6 +1848,48 @@ void Vehicle::WriteTRIFile( const string & file_name, int write_set )
 
 }
 
+//==== Cart3D Binary Tri - Big Endian Single Precision Fortran Records ====//
+void Vehicle::WriteBinTRIRecords( FILE* file_id, const vector< Geom* > & geom_vec, int write_set, int num_pnts, int num_tris )
+{
+    vector< MeshGeom* > mesh_vec;
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( geom_vec[i]->GetSetFlag( write_set ) && geom_vec[i]->GetType().m_Type == MESH_GEOM_TYPE )
+        {
+            mesh_vec.push_back( ( MeshGeom* )geom_vec[i] );
+        }
+    }
+
+    WriteBuffer buf;
+    buf.AppendBinInt( 2 * sizeof( int ), true );
+    buf.AppendBinInt( num_pnts, true );
+    buf.AppendBinInt( num_tris, true );
+    buf.AppendBinInt( 2 * sizeof( int ), true );
+    buf.Write( file_id );
+
+    WriteBinRecordMarker( file_id, 3 * sizeof( float ) * num_pnts );
+    for ( int i = 0 ; i < ( int )mesh_vec.size() ; i++ )
+    {
+        mesh_vec[i]->WriteBinCart3DPnts( file_id );
+    }
+    WriteBinRecordMarker( file_id, 3 * sizeof( float ) * num_pnts );
+
+    int offset = 0;
+    WriteBinRecordMarker( file_id, 3 * sizeof( int ) * num_tris );
+    for ( int i = 0 ; i < ( int )mesh_vec.size() ; i++ )
+    {
+        offset = mesh_vec[i]->WriteBinCart3DTris( file_id, offset );
+    }
+    WriteBinRecordMarker( file_id, 3 * sizeof( int ) * num_tris );
+
+    WriteBinRecordMarker( file_id, sizeof( int ) * num_tris );
+    for ( int i = 0 ; i < ( int )mesh_vec.size() ; i++ )
+    {
+        mesh_vec[i]->WriteBinCart3DParts( file_id );
+    }
+    WriteBinRecordMarker( file_id, sizeof( int ) * num_tris );
+}
+
 //==== Write Nascart Files ====//
 void Vehicle::WriteNascartFiles( const string & file_name, int write_set )
 {
@@ -2522,6 +2651,8 @@ void Vehicle::resetExportFileNames()
 
 string Vehicle::CompGeom( int set, int halfFlag, int intSubsFlag)
 {
+    //==== Node, Edge and Tri Allocation Counts In The Results Start Here ====//
+    TMeshArenaObj::ResetAllocCounts();
 
     string id = AddMeshGeom( set );
     if ( id.compare( "NONE" ) == 0 )
@@ -2573,6 +2704,9 @@ string Vehicle::CompGeomAndFlatten( int set, int halfFlag, int intSubsFlag )
 
 string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile )
 {
+    //==== Node, Edge and Tri Allocation Counts In The Results Start Here ====//
+    TMeshArenaObj::ResetAllocCounts();
+
     string id = AddMeshGeom( set );
     if ( id.compare( "NONE" ) == 0 )
     {
@@ -3002,13 +3136,17 @@ void Vehicle::ExportFile( const string & file_name, int write_set, int file_type
     }
     else if ( file_type == EXPORT_STL )
     {
-        if ( !m_STLMultiSolid() )
+        if ( m_STLMultiSolid() )
         {
-            WriteSTLFile( file_name, write_set );
+            WriteTaggedMSSTLFile( file_name, write_set );
+        }
+        else if ( m_STLBinary() )
+        {
+            WriteBinSTLFile( file_name, write_set );
         }
         else
         {
-            WriteTaggedMSSTLFile( file_name, write_set );
+            WriteSTLFile( file_name, write_set );
         }
     }
     else if ( file_type == EXPORT_CART3D )
@@ -184,8 +184,10 @@ public:
     void WriteXSecFile( const string & file_name, int write_set );
     void WritePLOT3DFile( const string & file_name, int write_set );
     void WriteSTLFile( const string & file_name, int write_set );
+    void WriteBinSTLFile( const string & file_name, int write_set );
     void WriteTaggedMSSTLFile( const string & file_name, int write_set );
     void WriteTRIFile( const string & file_name, int write_set );
+    void WriteBinTRIRecords( FILE* file_id, const vector< Geom* > & geom_vec, int write_set, int num_pnts, int num_tris );
     void WriteNascartFiles( const string & file_name, int write_set );
     void WriteGmshFile( const string & file_name, int write_set );
     void WriteX3DFile( const string & file_name, int write_set );
@@ -305,6 +307,11 @@ public:
     string m_BEMPropID;
 
     BoolParm m_STLMultiSolid;
+    BoolParm m_STLBinary;
+
+    BoolParm m_Cart3DBinary;
+
+    BoolParm m_BinaryMeshXml;
 
     BoolParm m_exportCompGeomCsvFile;
     BoolParm m_exportDragBuildTsvFile;
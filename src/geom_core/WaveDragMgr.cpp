@@ -468,6 +468,19 @@ void WaveDragSingleton::CalcDrag( )
     m_iMaxDrag = -1;
     double dmax = -1.0;
 
+    //==== Rotations Only Write Their Own Entries ====//
+    vector< double > dd_vec( m_NTheta );
+#pragma omp parallel for schedule( dynamic, 1 )
+    for ( int i = 0; i < m_NTheta; i++ )
+    {
+        dd_vec[i] = WaveDrag( i );
+
+        m_Length[i] = m_EndX[i] - m_StartX[i];
+
+        CalcVolArea( m_XNormFit, m_FitAreaDistFlow[i], m_Length[i], m_Volume[i], m_MaxArea[i] );
+    }
+
+    //==== Accumulate In Rotation Order ====//
     for ( int i = 0; i < m_NTheta; i++ )
     {
         double k = 1.0;
@@ -475,7 +488,7 @@ void WaveDragSingleton::CalcDrag( )
         {
             k = 0.5;
         }
-        double dd = WaveDrag( i );
+        double dd = dd_vec[i];
         D += dd * dtheta * k;
 
         if ( dd > dmax )
@@ -484,9 +497,6 @@ void WaveDragSingleton::CalcDrag( )
             m_iMaxDrag = i;
         }
 
-        m_Length[i] = m_EndX[i] - m_StartX[i];
-
-        CalcVolArea( m_XNormFit, m_FitAreaDistFlow[i], m_Length[i], m_Volume[i], m_MaxArea[i] );
         m_MaxMaxArea  = std::max( m_MaxMaxArea, m_MaxArea[i] );
 
     }
@@ -522,6 +532,7 @@ void WaveDragSingleton::FitBuildup()
     m_BuildupFitAreaDist.resize( m_NTheta );
     m_BuildupAreaDist.resize( m_NTheta );
 
+#pragma omp parallel for schedule( dynamic, 1 )
     for ( int itheta = 0; itheta < m_NTheta; itheta++ )
     {
         m_CompFitAreaDist[itheta].resize( m_NComp );
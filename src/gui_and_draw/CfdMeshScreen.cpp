@@ -104,6 +104,9 @@ void CfdMeshScreen::CreateGlobalTab()
     m_GlobalTabLayout.AddDividerBox("Geometry Control");
     m_GlobalTabLayout.AddYGap();
     m_GlobalTabLayout.AddButton(m_IntersectSubsurfaces, "Intersect Subsurfaces");
+    m_GlobalTabLayout.AddSlider(m_NumThreads, "Num Threads (0 = All)", 32.0, "%5.0f");
+    m_GlobalTabLayout.AddButton(m_ReuseMesh, "Reuse Unchanged Surface Meshes");
+    m_GlobalTabLayout.AddButton(m_QueueRemesh, "Queue Driven Split/Collapse");
     m_GlobalTabLayout.AddYGap();
 
     m_GlobalTabLayout.SetChoiceButtonWidth(m_GlobalTabLayout.GetRemainX() / 2.0);
@@ -599,6 +602,9 @@ void CfdMeshScreen::UpdateGlobalTab()
 
     //===== Geometry Control =====//
     m_IntersectSubsurfaces.Update( CfdMeshMgr.GetCfdSettingsPtr()->m_IntersectSubSurfs.GetID() );
+    m_NumThreads.Update( CfdMeshMgr.GetCfdSettingsPtr()->m_NumThreads.GetID() );
+    m_ReuseMesh.Update( CfdMeshMgr.GetCfdSettingsPtr()->m_ReuseMeshFlag.GetID() );
+    m_QueueRemesh.Update( CfdMeshMgr.GetCfdSettingsPtr()->m_QueueRemeshFlag.GetID() );
 }
 
 void CfdMeshScreen::UpdateDisplayTab()
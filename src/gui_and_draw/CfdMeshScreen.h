@@ -69,6 +69,9 @@ protected:
 
     ToggleButton m_Rig3dGrowthLimit;
     ToggleButton m_IntersectSubsurfaces;
+    SliderInput m_NumThreads;
+    ToggleButton m_ReuseMesh;
+    ToggleButton m_QueueRemesh;
 
     TriggerButton m_GlobSrcAdjustLenLftLft;
     TriggerButton m_GlobSrcAdjustLenLft;
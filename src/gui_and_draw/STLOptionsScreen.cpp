@@ -19,6 +19,7 @@ STLOptionsScreen::STLOptionsScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 250, 17
 
     m_OkFlag = false;
     m_PrevMultiSolid = false;
+    m_PrevBinary = false;
 
     m_GenLayout.SetGroupAndScreen( m_FLTK_Window, this );
     m_GenLayout.AddY( 25 );
@@ -26,8 +27,9 @@ STLOptionsScreen::STLOptionsScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 250, 17
     m_GenLayout.AddYGap();
 
     m_GenLayout.AddButton( m_MultiSolidToggle, "Tagged Multi Solid File (Non-Standard)" );
+    m_GenLayout.AddButton( m_BinaryToggle, "Binary File (Single Solid Only)" );
 
-    m_GenLayout.AddY( 95 );
+    m_GenLayout.AddY( 75 );
     m_GenLayout.SetFitWidthFlag( false );
     m_GenLayout.SetSameLineFlag( true );
     m_GenLayout.SetButtonWidth( 100 );
@@ -50,6 +52,16 @@ bool STLOptionsScreen::Update()
     if( veh )
     {
         m_MultiSolidToggle.Update( veh->m_STLMultiSolid.GetID() );
+        m_BinaryToggle.Update( veh->m_STLBinary.GetID() );
+
+        if ( veh->m_STLMultiSolid() )
+        {
+            m_BinaryToggle.Deactivate();
+        }
+        else
+        {
+            m_BinaryToggle.Activate();
+        }
     }
 
     m_FLTK_Window->redraw();
@@ -85,6 +97,7 @@ void STLOptionsScreen::GuiDeviceCallBack( GuiDevice* device )
         if( veh )
         {
             veh->m_STLMultiSolid.Set( m_PrevMultiSolid );
+            veh->m_STLBinary.Set( m_PrevBinary );
         }
         Hide();
     }
@@ -103,6 +116,7 @@ bool STLOptionsScreen::ShowSTLOptionsScreen()
     if( veh )
     {
         m_PrevMultiSolid = veh->m_STLMultiSolid();
+        m_PrevBinary = veh->m_STLBinary();
     }
 
     while( m_FLTK_Window->shown() )
@@ -122,6 +136,7 @@ void STLOptionsScreen::CloseCallBack( Fl_Widget *w )
     if( veh )
     {
         veh->m_STLMultiSolid.Set( m_PrevMultiSolid );
+        veh->m_STLBinary.Set( m_PrevBinary );
     }
 
     Hide();
@@ -39,8 +39,10 @@ protected:
     GroupLayout m_GenLayout;
 
     ToggleButton m_MultiSolidToggle;
+    ToggleButton m_BinaryToggle;
 
     bool m_PrevMultiSolid;
+    bool m_PrevBinary;
 
     TriggerButton m_OkButton;
     TriggerButton m_CancelButton;
@@ -0,0 +1,177 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// BndBoxTree.cpp: Bounding volume hierarchy over a set of bounding boxes.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "BndBoxTree.h"
+
+#include <algorithm>
+
+//==== Sort Box Indices Along One Axis By Box Center ====//
+class BndBoxCenterCompare
+{
+public:
+    BndBoxCenterCompare( const vector< vec3d > & cen_vec, int axis ) : m_CenVec( cen_vec ), m_Axis( axis ) {}
+
+    bool operator()( int a, int b ) const
+    {
+        if ( m_CenVec[a][m_Axis] == m_CenVec[b][m_Axis] )
+        {
+            return a < b;
+        }
+        return m_CenVec[a][m_Axis] < m_CenVec[b][m_Axis];
+    }
+
+    const vector< vec3d > & m_CenVec;
+    int m_Axis;
+};
+
+BndBoxTree::BndBoxTree()
+{
+}
+
+BndBoxTree::~BndBoxTree()
+{
+}
+
+void BndBoxTree::Clear()
+{
+    m_BoxVec.clear();
+    m_CenterVec.clear();
+    m_IndVec.clear();
+    m_NodeVec.clear();
+}
+
+void BndBoxTree::Build( const vector< BndBox > & box_vec, int leaf_size )
+{
+    Clear();
+
+    m_BoxVec = box_vec;
+    if ( m_BoxVec.empty() )
+    {
+        return;
+    }
+
+    if ( leaf_size < 1 )
+    {
+        leaf_size = 1;
+    }
+
+    m_CenterVec.resize( m_BoxVec.size() );
+    m_IndVec.resize( m_BoxVec.size() );
+    for ( int i = 0 ; i < ( int )m_BoxVec.size() ; i++ )
+    {
+        m_CenterVec[i] = m_BoxVec[i].GetCenter();
+        m_IndVec[i] = i;
+    }
+
+    m_NodeVec.reserve( 2 * m_BoxVec.size() / leaf_size + 1 );
+    BuildNode( 0, ( int )m_IndVec.size(), leaf_size );
+}
+
+//==== Median Split Along Longest Axis of Box Centers ====//
+int BndBoxTree::BuildNode( int start, int num, int leaf_size )
+{
+    int nid = ( int )m_NodeVec.size();
+    m_NodeVec.push_back( BndBoxTreeNode() );
+
+    BndBox box;
+    BndBox cen_box;
+    for ( int i = start ; i < start + num ; i++ )
+    {
+        box.Update( m_BoxVec[ m_IndVec[i] ] );
+        cen_box.Update( m_CenterVec[ m_IndVec[i] ] );
+    }
+
+    m_NodeVec[nid].m_Box = box;
+    m_NodeVec[nid].m_Start = start;
+    m_NodeVec[nid].m_Num = num;
+    m_NodeVec[nid].m_Child[0] = m_NodeVec[nid].m_Child[1] = -1;
+
+    if ( num <= leaf_size )
+    {
+        return nid;
+    }
+
+    int axis = 0;
+    for ( int i = 1 ; i < 3 ; i++ )
+    {
+        if ( ( cen_box.GetMax( i ) - cen_box.GetMin( i ) ) > ( cen_box.GetMax( axis ) - cen_box.GetMin( axis ) ) )
+        {
+            axis = i;
+        }
+    }
+
+    int half = num / 2;
+    std::nth_element( m_IndVec.begin() + start, m_IndVec.begin() + start + half,
+                      m_IndVec.begin() + start + num, BndBoxCenterCompare( m_CenterVec, axis ) );
+
+    int c0 = BuildNode( start, half, leaf_size );
+    int c1 = BuildNode( start + half, num - half, leaf_size );
+
+    m_NodeVec[nid].m_Child[0] = c0;
+    m_NodeVec[nid].m_Child[1] = c1;
+
+    return nid;
+}
+
+void BndBoxTree::FindOverlap( const BndBox & box, vector< int > & ind_vec, double tol ) const
+{
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
+    {
+        const BndBoxTreeNode & node = m_NodeVec[ stack.back() ];
+        stack.pop_back();
+
+        if ( !Compare( node.m_Box, box, tol ) )
+        {
+            continue;
+        }
+
+        if ( node.m_Child[0] < 0 )
+        {
+            for ( int i = node.m_Start ; i < node.m_Start + node.m_Num ; i++ )
+            {
+                if ( Compare( m_BoxVec[ m_IndVec[i] ], box, tol ) )
+                {
+                    ind_vec.push_back( m_IndVec[i] );
+                }
+            }
+        }
+        else
+        {
+            stack.push_back( node.m_Child[0] );
+            stack.push_back( node.m_Child[1] );
+        }
+    }
+}
+
+void BndBoxTree::FindOverlapPairs( vector< pair< int, int > > & pair_vec, double tol ) const
+{
+    vector< int > ind_vec;
+    for ( int i = 0 ; i < ( int )m_BoxVec.size() ; i++ )
+    {
+        ind_vec.clear();
+        FindOverlap( m_BoxVec[i], ind_vec, tol );
+
+        std::sort( ind_vec.begin(), ind_vec.end() );
+        for ( int j = 0 ; j < ( int )ind_vec.size() ; j++ )
+        {
+            if ( ind_vec[j] > i )
+            {
+                pair_vec.push_back( pair< int, int >( i, ind_vec[j] ) );
+            }
+        }
+    }
+}
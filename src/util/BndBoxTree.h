@@ -0,0 +1,64 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// BndBoxTree.h: Bounding volume hierarchy over a set of bounding boxes.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(BNDBOXTREE__INCLUDED_)
+#define BNDBOXTREE__INCLUDED_
+
+#include "BndBox.h"
+
+#include <vector>
+#include <utility>
+using std::vector;
+using std::pair;
+
+//==== Tree Node - Leaf If m_Child[0] < 0 ====//
+struct BndBoxTreeNode
+{
+    BndBox m_Box;
+    int m_Child[2];
+    int m_Start;            // Leaf Range in Index Vector
+    int m_Num;
+};
+
+//////////////////////////////////////////////////////////////////////
+class BndBoxTree
+{
+public:
+
+    BndBoxTree();
+    virtual ~BndBoxTree();
+
+    void Clear();
+
+    //==== Build Tree - Box Indices Returned By Queries Refer to box_vec ====//
+    void Build( const vector< BndBox > & box_vec, int leaf_size = 4 );
+
+    //==== Find All Boxes Overlapping Box (Same Test As Compare) ====//
+    void FindOverlap( const BndBox & box, vector< int > & ind_vec, double tol = 1.0e-12 ) const;
+
+    //==== Find All Overlapping Pairs i < j - Sorted By i Then j ====//
+    void FindOverlapPairs( vector< pair< int, int > > & pair_vec, double tol = 1.0e-12 ) const;
+
+    int GetNumBoxes() const
+    {
+        return ( int )m_BoxVec.size();
+    }
+
+protected:
+
+    int BuildNode( int start, int num, int leaf_size );
+
+    vector< BndBox > m_BoxVec;
+    vector< vec3d > m_CenterVec;
+    vector< int > m_IndVec;
+    vector< BndBoxTreeNode > m_NodeVec;
+
+};
+
+#endif
@@ -0,0 +1,185 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// CompressUtil.cpp: zlib streams through the bundled stb codec, base64 and byte shuffling.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "CompressUtil.h"
+#include "stb_image.h"
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+//==== Defined With stb_image_write Implementation But Not Declared In Its Header ====//
+unsigned char * stbi_zlib_compress( unsigned char *data, int data_len, int *out_len, int quality );
+
+//==== stb Hash Chain Length - Higher Is Smaller And Slower ====//
+static const int ZLIB_QUALITY = 8;
+
+static const char s_Base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+//==== Character To 6 Bit Value, -1 Outside The Alphabet ====//
+struct Base64Table
+{
+    Base64Table()
+    {
+        memset( m_Val, -1, sizeof( m_Val ) );
+        for ( int i = 0 ; i < 64 ; i++ )
+        {
+            m_Val[ ( unsigned char )s_Base64Chars[i] ] = ( signed char )i;
+        }
+    }
+    signed char m_Val[256];
+};
+
+bool ZlibCompress( const unsigned char* data, size_t size, vector< unsigned char > & comp )
+{
+    comp.clear();
+    if ( size > INT_MAX )
+    {
+        return false;
+    }
+
+    int comp_size = 0;
+    unsigned char* buf = stbi_zlib_compress( const_cast< unsigned char* >( data ), ( int )size, &comp_size, ZLIB_QUALITY );
+    if ( !buf )
+    {
+        return false;
+    }
+
+    comp.assign( buf, buf + comp_size );
+    free( buf );
+    return true;
+}
+
+//==== stb Fills Its Fixed Huffman Tables Lazily Without A Lock - Fill Them Once Before Any Parallel Decode ====//
+static void InitZlibTables()
+{
+    static std::once_flag init_flag;
+    std::call_once( init_flag, []()
+    {
+        //==== Empty zlib Stream Holding One Fixed Huffman Block ====//
+        const unsigned char empty_stream[] = { 0x78, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01 };
+        char out[1];
+        stbi_zlib_decode_buffer( out, sizeof( out ), ( const char* )empty_stream, sizeof( empty_stream ) );
+    } );
+}
+
+bool ZlibDecompress( const unsigned char* comp, size_t comp_size, size_t size, unsigned char* data )
+{
+    InitZlibTables();
+
+    if ( comp_size > INT_MAX || size > INT_MAX )
+    {
+        return false;
+    }
+    if ( size == 0 )
+    {
+        return true;
+    }
+
+    int num = stbi_zlib_decode_buffer( ( char* )data, ( int )size, ( const char* )comp, ( int )comp_size );
+    return num == ( int )size;
+}
+
+string Base64Encode( const unsigned char* data, size_t size )
+{
+    string str( 4 * ( ( size + 2 ) / 3 ), '=' );
+
+    size_t j = 0;
+    size_t i = 0;
+    for ( ; i + 2 < size ; i += 3 )
+    {
+        unsigned int v = ( data[i] << 16 ) | ( data[i + 1] << 8 ) | data[i + 2];
+        str[j++] = s_Base64Chars[ ( v >> 18 ) & 63 ];
+        str[j++] = s_Base64Chars[ ( v >> 12 ) & 63 ];
+        str[j++] = s_Base64Chars[ ( v >> 6 ) & 63 ];
+        str[j++] = s_Base64Chars[ v & 63 ];
+    }
+
+    if ( i < size )
+    {
+        unsigned int v = data[i] << 16;
+        if ( i + 1 < size )
+        {
+            v |= data[i + 1] << 8;
+        }
+        str[j++] = s_Base64Chars[ ( v >> 18 ) & 63 ];
+        str[j++] = s_Base64Chars[ ( v >> 12 ) & 63 ];
+        if ( i + 1 < size )
+        {
+            str[j++] = s_Base64Chars[ ( v >> 6 ) & 63 ];
+        }
+    }
+    return str;
+}
+
+bool Base64Decode( const char* str, size_t len, vector< unsigned char > & data )
+{
+    //==== Built Once, Thread Safe ====//
+    static const Base64Table table;
+
+    data.clear();
+    data.reserve( 3 * ( len / 4 ) );
+
+    unsigned int v = 0;
+    int num_bits = 0;
+    bool pad_flag = false;
+    for ( size_t i = 0 ; i < len ; i++ )
+    {
+        unsigned char c = ( unsigned char )str[i];
+        if ( c == ' ' || c == '\n' || c == '\r' || c == '\t' )
+        {
+            continue;
+        }
+        if ( c == '=' )
+        {
+            pad_flag = true;
+            continue;
+        }
+
+        int d = table.m_Val[c];
+        if ( d < 0 || pad_flag )
+        {
+            return false;
+        }
+
+        v = ( v << 6 ) | d;
+        num_bits += 6;
+        if ( num_bits >= 8 )
+        {
+            num_bits -= 8;
+            data.push_back( ( unsigned char )( ( v >> num_bits ) & 0xff ) );
+        }
+    }
+    return true;
+}
+
+void ShuffleBytes( const unsigned char* in, size_t num_val, int val_size, unsigned char* out )
+{
+    for ( int b = 0 ; b < val_size ; b++ )
+    {
+        unsigned char* plane = out + b * num_val;
+        for ( size_t i = 0 ; i < num_val ; i++ )
+        {
+            plane[i] = in[ i * val_size + b ];
+        }
+    }
+}
+
+void UnshuffleBytes( const unsigned char* in, size_t num_val, int val_size, unsigned char* out )
+{
+    for ( int b = 0 ; b < val_size ; b++ )
+    {
+        const unsigned char* plane = in + b * num_val;
+        for ( size_t i = 0 ; i < num_val ; i++ )
+        {
+            out[ i * val_size + b ] = plane[i];
+        }
+    }
+}
@@ -0,0 +1,36 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// CompressUtil.h: zlib streams through the bundled stb codec, base64 and byte shuffling.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_COMPRESS_UTIL__INCLUDED_)
+#define VSP_COMPRESS_UTIL__INCLUDED_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+//==== zlib Stream (Header, Deflate, Adler32) - False On Failure ====//
+bool ZlibCompress( const unsigned char* data, size_t size, vector< unsigned char > & comp );
+
+//==== size Is The Expected Uncompressed Size - False If Stream Is Bad Or Size Differs ====//
+bool ZlibDecompress( const unsigned char* comp, size_t comp_size, size_t size, unsigned char* data );
+
+//==== RFC 4648 Base64 With Padding ====//
+string Base64Encode( const unsigned char* data, size_t size );
+
+//==== Whitespace Is Skipped - False On Any Other Character Outside The Alphabet ====//
+bool Base64Decode( const char* str, size_t len, vector< unsigned char > & data );
+
+//==== Byte i Of Every val_size Byte Value Is Grouped Together, So Like Bytes ====//
+//==== (Exponents, High Index Bytes) Sit Side By Side For The Compressor.   ====//
+void ShuffleBytes( const unsigned char* in, size_t num_val, int val_size, unsigned char* out );
+void UnshuffleBytes( const unsigned char* in, size_t num_val, int val_size, unsigned char* out );
+
+#endif
@@ -0,0 +1,48 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// ContentHash.cpp: 64 bit FNV-1a hash accumulated over raw data.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "ContentHash.h"
+
+ContentHash::ContentHash()
+{
+    m_Hash = 14695981039346656037ULL;
+}
+
+void ContentHash::Add( const void* data, size_t num_bytes )
+{
+    const unsigned char* bytes = static_cast< const unsigned char* >( data );
+    for ( size_t i = 0 ; i < num_bytes ; i++ )
+    {
+        m_Hash ^= bytes[i];
+        m_Hash *= 1099511628211ULL;
+    }
+}
+
+void ContentHash::Add( double val )
+{
+    Add( &val, sizeof( val ) );
+}
+
+void ContentHash::Add( int val )
+{
+    Add( &val, sizeof( val ) );
+}
+
+void ContentHash::Add( const vec2d & v )
+{
+    Add( v.x() );
+    Add( v.y() );
+}
+
+void ContentHash::Add( const vec3d & v )
+{
+    Add( v.x() );
+    Add( v.y() );
+    Add( v.z() );
+}
@@ -0,0 +1,43 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// ContentHash.h: 64 bit FNV-1a hash accumulated over raw data.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(CONTENTHASH__INCLUDED_)
+#define CONTENTHASH__INCLUDED_
+
+#include "Vec2d.h"
+#include "Vec3d.h"
+
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////
+//==== Values Are Hashed By Their Bytes - Equal Hashes Mean Identical Input ====//
+class ContentHash
+{
+public:
+
+    ContentHash();
+
+    void Add( const void* data, size_t num_bytes );
+    void Add( double val );
+    void Add( int val );
+    void Add( const vec2d & v );
+    void Add( const vec3d & v );
+
+    unsigned long long Get() const
+    {
+        return m_Hash;
+    }
+
+protected:
+
+    unsigned long long m_Hash;
+
+};
+
+#endif
@@ -17,8 +17,13 @@
 #include <unistd.h>
 #include <libgen.h>
 #include <pwd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
+#include <cstdio>
+
 
 vector< string > ScanFolder( const char* dir_path )
 {
@@ -305,3 +310,124 @@ string GetFilename( const string &pathfile )
     return fileParts.back();
 
 }
+
+//===============================================//
+//                  MappedFile
+//===============================================//
+MappedFile::MappedFile()
+{
+    m_Data = NULL;
+    m_Size = 0;
+    m_MapPtr = NULL;
+#ifdef WIN32
+    m_FileHandle = NULL;
+    m_MapHandle = NULL;
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open( const string & file_name )
+{
+    Close();
+
+#ifdef WIN32
+    HANDLE file_handle = CreateFileA( file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                      FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+    if ( file_handle == INVALID_HANDLE_VALUE )
+    {
+        return false;
+    }
+
+    LARGE_INTEGER file_size;
+    if ( GetFileSizeEx( file_handle, &file_size ) && file_size.QuadPart > 0 )
+    {
+        HANDLE map_handle = CreateFileMappingA( file_handle, NULL, PAGE_READONLY, 0, 0, NULL );
+        if ( map_handle )
+        {
+            m_MapPtr = MapViewOfFile( map_handle, FILE_MAP_READ, 0, 0, 0 );
+            if ( m_MapPtr )
+            {
+                m_FileHandle = file_handle;
+                m_MapHandle = map_handle;
+                m_Data = ( const char* )m_MapPtr;
+                m_Size = ( size_t )file_size.QuadPart;
+                return true;
+            }
+            CloseHandle( map_handle );
+        }
+    }
+    CloseHandle( file_handle );
+#else
+    int fd = open( file_name.c_str(), O_RDONLY );
+    if ( fd < 0 )
+    {
+        return false;
+    }
+
+    struct stat st;
+    if ( fstat( fd, &st ) == 0 && st.st_size > 0 )
+    {
+        void* ptr = mmap( NULL, ( size_t )st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( ptr != MAP_FAILED )
+        {
+            //==== Mapping Stays Valid After Descriptor Is Closed ====//
+            close( fd );
+            m_MapPtr = ptr;
+            m_Data = ( const char* )ptr;
+            m_Size = ( size_t )st.st_size;
+            return true;
+        }
+    }
+    close( fd );
+#endif
+
+    return ReadBuffer( file_name );
+}
+
+//==== Fall Back For Empty Files Or Files That Can Not Be Mapped ====//
+bool MappedFile::ReadBuffer( const string & file_name )
+{
+    FILE* fp = fopen( file_name.c_str(), "rb" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    m_Buffer.clear();
+    char buf[ 65536 ];
+    size_t num;
+    while ( ( num = fread( buf, 1, sizeof( buf ), fp ) ) > 0 )
+    {
+        m_Buffer.insert( m_Buffer.end(), buf, buf + num );
+    }
+    fclose( fp );
+
+    m_Data = m_Buffer.empty() ? NULL : &m_Buffer[0];
+    m_Size = m_Buffer.size();
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if ( m_MapPtr )
+    {
+#ifdef WIN32
+        UnmapViewOfFile( m_MapPtr );
+        CloseHandle( ( HANDLE )m_MapHandle );
+        CloseHandle( ( HANDLE )m_FileHandle );
+        m_MapHandle = NULL;
+        m_FileHandle = NULL;
+#else
+        munmap( m_MapPtr, m_Size );
+#endif
+        m_MapPtr = NULL;
+    }
+
+    vector< char >().swap( m_Buffer );
+    m_Data = NULL;
+    m_Size = 0;
+}
@@ -21,5 +21,45 @@ bool CheckForFile( const string & path, string &file );
 bool FileExist( const string & file );
 string GetFilename( const string &pathfile );
 
+//==== Read Only View Of A Whole File - Memory Mapped When The OS Allows, Else Read Into A Buffer ====//
+class MappedFile
+{
+public:
+
+    MappedFile();
+    virtual ~MappedFile();
+
+    bool Open( const string & file_name );
+    void Close();
+
+    const char* GetData() const
+    {
+        return m_Data;
+    }
+    size_t GetSize() const
+    {
+        return m_Size;
+    }
+
+protected:
+
+    //==== Mapping Is Owned By One Object ====//
+    MappedFile( const MappedFile & );
+    MappedFile & operator=( const MappedFile & );
+
+    bool ReadBuffer( const string & file_name );
+
+    const char* m_Data;
+    size_t m_Size;
+
+    void* m_MapPtr;
+#ifdef WIN32
+    void* m_FileHandle;
+    void* m_MapHandle;
+#endif
+
+    vector< char > m_Buffer;
+};
+
 #endif
 
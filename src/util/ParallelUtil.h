@@ -0,0 +1,59 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// ParallelUtil.h: Thin wrappers around OpenMP so callers build with or without it.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_PARALLEL_UTIL__INCLUDED_)
+#define VSP_PARALLEL_UTIL__INCLUDED_
+
+#ifdef VSP_USE_OPENMP
+#include <omp.h>
+#endif
+
+//==== Max Number of Threads Used By Parallel Regions ====//
+inline int GetMaxNumThreads()
+{
+#ifdef VSP_USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+//==== Set Number of Threads - Values < 1 Restore All Available Cores ====//
+inline void SetMaxNumThreads( int num )
+{
+#ifdef VSP_USE_OPENMP
+    if ( num < 1 )
+    {
+        num = omp_get_num_procs();
+    }
+    omp_set_num_threads( num );
+#endif
+}
+
+//==== Index of Calling Thread Within Current Parallel Region ====//
+inline int GetThreadNum()
+{
+#ifdef VSP_USE_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+//==== Number of Nested Parallel Regions Enclosing Caller - 0 When Serial ====//
+inline int GetParallelLevel()
+{
+#ifdef VSP_USE_OPENMP
+    return omp_get_level();
+#else
+    return 0;
+#endif
+}
+
+#endif
@@ -0,0 +1,277 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// PntHash.cpp: Sparse grid spatial hash for welding coincident points.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "PntHash.h"
+#include "BndBox.h"
+
+#include <algorithm>
+
+PntHash::PntHash()
+{
+    Clear();
+}
+
+PntHash::~PntHash()
+{
+}
+
+void PntHash::Clear()
+{
+    m_Tol = 1.0e-12;
+    m_CellSize = 1.0;
+    m_Origin = vec3d();
+    m_NumUnique = 0;
+
+    m_SortPntVec.clear();
+    m_UniqueFlagVec.clear();
+    m_SortUniqueFlagVec.clear();
+    m_SortIndVec.clear();
+    m_CellStartMap.clear();
+    m_KeyVec.clear();
+}
+
+void PntHash::Build( const vector< vec3d* > & pnt_vec, double tol )
+{
+    BuildGrid( pnt_vec, tol );
+
+    int npnt = ( int )pnt_vec.size();
+    if ( npnt == 0 )
+    {
+        return;
+    }
+
+    //==== Unique Points Depend On Earlier Unique Points - Mark In Index Order ====//
+    vector< int > sort_pos_vec( npnt );
+    for ( int k = 0 ; k < npnt ; k++ )
+    {
+        sort_pos_vec[ m_SortIndVec[k] ] = k;
+    }
+
+    m_UniqueFlagVec.resize( npnt, false );
+    m_SortUniqueFlagVec.resize( npnt, 0 );
+    for ( int i = 0 ; i < npnt ; i++ )
+    {
+        if ( FindMatch( *pnt_vec[i], i ) < 0 )
+        {
+            m_UniqueFlagVec[i] = true;
+            m_SortUniqueFlagVec[ sort_pos_vec[i] ] = 1;
+            m_NumUnique++;
+        }
+    }
+}
+
+void PntHash::BuildGrid( const vector< vec3d* > & pnt_vec, double tol )
+{
+    Clear();
+
+    m_Tol = tol;
+
+    int npnt = ( int )pnt_vec.size();
+    if ( npnt == 0 )
+    {
+        return;
+    }
+
+    BndBox box;
+    for ( int i = 0 ; i < npnt ; i++ )
+    {
+        box.Update( *pnt_vec[i] );
+    }
+    m_Origin = box.GetMin();
+
+    //==== Mesh Points Lie On Surfaces - About One Point Per Occupied Cell ====//
+    m_CellSize = std::max( box.DiagDist() / sqrt( ( double )npnt ), 2.0 * m_Tol );
+    if ( !( m_CellSize > 0.0 ) )
+    {
+        m_CellSize = 1.0;
+    }
+
+    vector< pair< long long, int > > key_ind_vec( npnt );
+    SortCellKeys( pnt_vec, key_ind_vec );
+
+    //==== Clustered Points Pile Into Few Cells and Scans Go Quadratic - Use ====//
+    //==== Cells Two Tol Wide, Which Only Hold Points That Nearly Match      ====//
+    if ( m_Tol > 0.0 && m_CellSize > 2.0 * m_Tol && GetMaxCellCount( key_ind_vec ) > MAX_CELL_PNTS )
+    {
+        m_CellSize = 2.0 * m_Tol;
+        SortCellKeys( pnt_vec, key_ind_vec );
+    }
+
+    m_KeyVec.resize( npnt );
+    m_SortIndVec.resize( npnt );
+    m_SortPntVec.resize( npnt );
+
+    #pragma omp parallel for
+    for ( int k = 0 ; k < npnt ; k++ )
+    {
+        m_KeyVec[k] = key_ind_vec[k].first;
+        m_SortIndVec[k] = key_ind_vec[k].second;
+        m_SortPntVec[k] = *pnt_vec[ key_ind_vec[k].second ];
+    }
+
+    m_CellStartMap.reserve( npnt );
+    for ( int k = 0 ; k < npnt ; k++ )
+    {
+        if ( k == 0 || m_KeyVec[k] != m_KeyVec[k - 1] )
+        {
+            m_CellStartMap[ m_KeyVec[k] ] = k;
+        }
+    }
+}
+
+//==== Sort By Cell Then Index - Cell Scans Are Contiguous and Ascending ====//
+void PntHash::SortCellKeys( const vector< vec3d* > & pnt_vec, vector< pair< long long, int > > & key_ind_vec ) const
+{
+    int npnt = ( int )pnt_vec.size();
+
+    //==== Cell Keys Are Independent Per Point ====//
+    #pragma omp parallel for
+    for ( int i = 0 ; i < npnt ; i++ )
+    {
+        const vec3d & p = *pnt_vec[i];
+        key_ind_vec[i].first = CellKey( CellIndex( p.x() - m_Origin.x() ), CellIndex( p.y() - m_Origin.y() ), CellIndex( p.z() - m_Origin.z() ) );
+        key_ind_vec[i].second = i;
+    }
+
+    std::sort( key_ind_vec.begin(), key_ind_vec.end() );
+}
+
+int PntHash::GetMaxCellCount( const vector< pair< long long, int > > & key_ind_vec ) const
+{
+    int max_cnt = 0;
+    int cnt = 0;
+    for ( int k = 0 ; k < ( int )key_ind_vec.size() ; k++ )
+    {
+        if ( k == 0 || key_ind_vec[k].first != key_ind_vec[k - 1].first )
+        {
+            cnt = 0;
+        }
+        cnt++;
+        max_cnt = std::max( max_cnt, cnt );
+    }
+    return max_cnt;
+}
+
+int PntHash::FindMatch( const vec3d & pnt ) const
+{
+    return FindMatch( pnt, GetNumPnts() );
+}
+
+int PntHash::FindMatch( const vec3d & pnt, int max_ind ) const
+{
+    if ( m_SortIndVec.empty() )
+    {
+        return -1;
+    }
+
+    //==== Cells Within Tol of Point ====//
+    long long ix0 = CellIndex( pnt.x() - m_Origin.x() - m_Tol );
+    long long ix1 = CellIndex( pnt.x() - m_Origin.x() + m_Tol );
+    long long iy0 = CellIndex( pnt.y() - m_Origin.y() - m_Tol );
+    long long iy1 = CellIndex( pnt.y() - m_Origin.y() + m_Tol );
+    long long iz0 = CellIndex( pnt.z() - m_Origin.z() - m_Tol );
+    long long iz1 = CellIndex( pnt.z() - m_Origin.z() + m_Tol );
+
+    int match = -1;
+    for ( long long ix = ix0 ; ix <= ix1 ; ix++ )
+    {
+        for ( long long iy = iy0 ; iy <= iy1 ; iy++ )
+        {
+            for ( long long iz = iz0 ; iz <= iz1 ; iz++ )
+            {
+                long long key = CellKey( ix, iy, iz );
+                unordered_map< long long, int >::const_iterator iter = m_CellStartMap.find( key );
+                if ( iter == m_CellStartMap.end() )
+                {
+                    continue;
+                }
+
+                //==== Cell Indices Are Ascending - First Match Is Lowest In Cell ====//
+                for ( int k = iter->second ; k < ( int )m_KeyVec.size() && m_KeyVec[k] == key ; k++ )
+                {
+                    int ind = m_SortIndVec[k];
+                    if ( ind >= max_ind || ( match >= 0 && ind > match ) )
+                    {
+                        break;
+                    }
+
+                    if ( m_SortUniqueFlagVec[k] &&
+                            fabs( pnt.x() - m_SortPntVec[k].x() ) < m_Tol &&
+                            fabs( pnt.y() - m_SortPntVec[k].y() ) < m_Tol &&
+                            fabs( pnt.z() - m_SortPntVec[k].z() ) < m_Tol )
+                    {
+                        match = ind;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    return match;
+}
+
+void PntHash::FindAllMatches( const vec3d & pnt, vector< int > & ind_vec ) const
+{
+    ind_vec.clear();
+    if ( m_SortIndVec.empty() )
+    {
+        return;
+    }
+
+    long long ix0 = CellIndex( pnt.x() - m_Origin.x() - m_Tol );
+    long long ix1 = CellIndex( pnt.x() - m_Origin.x() + m_Tol );
+    long long iy0 = CellIndex( pnt.y() - m_Origin.y() - m_Tol );
+    long long iy1 = CellIndex( pnt.y() - m_Origin.y() + m_Tol );
+    long long iz0 = CellIndex( pnt.z() - m_Origin.z() - m_Tol );
+    long long iz1 = CellIndex( pnt.z() - m_Origin.z() + m_Tol );
+
+    for ( long long ix = ix0 ; ix <= ix1 ; ix++ )
+    {
+        for ( long long iy = iy0 ; iy <= iy1 ; iy++ )
+        {
+            for ( long long iz = iz0 ; iz <= iz1 ; iz++ )
+            {
+                long long key = CellKey( ix, iy, iz );
+                unordered_map< long long, int >::const_iterator iter = m_CellStartMap.find( key );
+                if ( iter == m_CellStartMap.end() )
+                {
+                    continue;
+                }
+
+                for ( int k = iter->second ; k < ( int )m_KeyVec.size() && m_KeyVec[k] == key ; k++ )
+                {
+                    if ( fabs( pnt.x() - m_SortPntVec[k].x() ) < m_Tol &&
+                            fabs( pnt.y() - m_SortPntVec[k].y() ) < m_Tol &&
+                            fabs( pnt.z() - m_SortPntVec[k].z() ) < m_Tol )
+                    {
+                        ind_vec.push_back( m_SortIndVec[k] );
+                    }
+                }
+            }
+        }
+    }
+}
+
+//==== Cell Index Along One Axis - Clamped So Distant Points Stay In Range ====//
+long long PntHash::CellIndex( double x ) const
+{
+    double ind = floor( x / m_CellSize );
+    ind = std::min( std::max( ind, -1.0e15 ), 1.0e15 );
+    return ( long long )ind;
+}
+
+//==== Hash Of Cell Indices - Only Occupied Cells Are Stored, So The Grid Is ====//
+//==== Unbounded.  Cells Sharing A Key Only Cost Extra Tests.                ====//
+long long PntHash::CellKey( long long ix, long long iy, long long iz ) const
+{
+    unsigned long long key = ( unsigned long long )ix * 73856093ULL;
+    key ^= ( unsigned long long )iy * 19349663ULL;
+    key ^= ( unsigned long long )iz * 83492791ULL;
+    return ( long long )key;
+}
@@ -0,0 +1,88 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// PntHash.h: Sparse grid spatial hash for welding coincident points.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(PNTHASH__INCLUDED_)
+#define PNTHASH__INCLUDED_
+
+#include "Vec3d.h"
+
+#include <vector>
+#include <utility>
+#include <unordered_map>
+using std::vector;
+using std::pair;
+using std::unordered_map;
+
+//////////////////////////////////////////////////////////////////////
+//==== Points Match When Each Coordinate Differs By Less Than Tol.  The First ====//
+//==== Point (By Index) Not Matching An Earlier Unique Point Is Itself Unique. ====//
+class PntHash
+{
+public:
+
+    PntHash();
+    virtual ~PntHash();
+
+    void Clear();
+
+    void Build( const vector< vec3d* > & pnt_vec, double tol = 1.0e-12 );
+
+    //==== Cells Only - Skips Unique Point Marking, For FindAllMatches ====//
+    void BuildGrid( const vector< vec3d* > & pnt_vec, double tol );
+
+    //==== Lowest Index Unique Point Matching pnt, -1 If None ====//
+    int FindMatch( const vec3d & pnt ) const;
+
+    //==== Every Point Matching pnt, Unique Or Not, In No Particular Order ====//
+    void FindAllMatches( const vec3d & pnt, vector< int > & ind_vec ) const;
+
+    bool IsUnique( int i ) const
+    {
+        return m_UniqueFlagVec[i];
+    }
+    int GetNumUnique() const
+    {
+        return m_NumUnique;
+    }
+    int GetNumPnts() const
+    {
+        return ( int )m_SortIndVec.size();
+    }
+
+protected:
+
+    //==== More Points In A Cell Means Clustering - Cells Shrink To Tol ====//
+    enum { MAX_CELL_PNTS = 256 };
+
+    long long CellKey( long long ix, long long iy, long long iz ) const;
+    long long CellIndex( double x ) const;
+
+    void SortCellKeys( const vector< vec3d* > & pnt_vec, vector< pair< long long, int > > & key_ind_vec ) const;
+    int GetMaxCellCount( const vector< pair< long long, int > > & key_ind_vec ) const;
+
+    //==== Lowest Index Unique Point Matching pnt With Index < max_ind ====//
+    int FindMatch( const vec3d & pnt, int max_ind ) const;
+
+    double m_Tol;
+    double m_CellSize;
+    vec3d m_Origin;
+
+    vector< bool > m_UniqueFlagVec;
+    int m_NumUnique;
+
+    //==== Points Sorted By Cell Then Index ====//
+    vector< int > m_SortIndVec;                         // Original Index
+    vector< vec3d > m_SortPntVec;
+    vector< long long > m_KeyVec;
+    vector< char > m_SortUniqueFlagVec;
+    unordered_map< long long, int > m_CellStartMap;     // Key -> First Sorted Position - Only Occupied Cells
+
+};
+
+#endif
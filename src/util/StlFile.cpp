@@ -0,0 +1,465 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// StlFile.cpp: Stereolithography file reader - mapped, parallel parse and vertex weld.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "StlFile.h"
+#include "FileUtil.h"
+#include "ParallelUtil.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+//==== Binary Facet - Normal, 3 Vertices, Attribute Count ====//
+static const int BIN_HEADER_SIZE = 84;
+static const int BIN_FACET_SIZE = 50;
+
+//==== ASCII Chunk Size Target For Parallel Parse ====//
+static const size_t ASCII_CHUNK_SIZE = 256 * 1024;
+
+//==== C Locale Whitespace Without A Library Call ====//
+static inline bool IsSpace( char c )
+{
+    return c == ' ' || ( c >= '\t' && c <= '\r' );
+}
+
+//==== Little Endian Values Independent Of Host Byte Order ====//
+static inline unsigned int ReadLEUInt( const char* p )
+{
+    const unsigned char* u = ( const unsigned char* )p;
+    return ( unsigned int )u[0] | ( ( unsigned int )u[1] << 8 ) | ( ( unsigned int )u[2] << 16 ) | ( ( unsigned int )u[3] << 24 );
+}
+
+static inline float ReadLEFloat( const char* p )
+{
+    unsigned int u = ReadLEUInt( p );
+    float f;
+    memcpy( &f, &u, sizeof( f ) );
+    return f;
+}
+
+//==== Next Whitespace Delimited Token - Length 0 At End ====//
+static inline const char* NextToken( const char* p, const char* end, int & len )
+{
+    while ( p < end && IsSpace( *p ) )
+    {
+        p++;
+    }
+    const char* tok = p;
+    while ( p < end && !IsSpace( *p ) )
+    {
+        p++;
+    }
+    len = ( int )( p - tok );
+    return tok;
+}
+
+static inline bool TokenIs( const char* tok, int len, const char* word )
+{
+    return len == ( int )strlen( word ) && strncmp( tok, word, len ) == 0;
+}
+
+//==== Decimal Float Without Locale Or Null Terminator - Unusual Forms Use strtod ====//
+static bool ParseFloat( const char* & p, const char* end, float & val )
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+                                  };
+
+    int len;
+    const char* tok = NextToken( p, end, len );
+    if ( len == 0 )
+    {
+        return false;
+    }
+    p = tok + len;
+
+    const char* c = tok;
+    const char* tok_end = tok + len;
+
+    bool neg = false;
+    if ( *c == '-' || *c == '+' )
+    {
+        neg = ( *c == '-' );
+        c++;
+    }
+
+    unsigned long long mant = 0;
+    int num_dig = 0;
+    int exp10 = 0;
+    bool dig_flag = false;
+
+    for ( ; c < tok_end && *c >= '0' && *c <= '9' ; c++ )
+    {
+        dig_flag = true;
+        if ( num_dig < 19 )
+        {
+            mant = mant * 10 + ( *c - '0' );
+            if ( mant )
+            {
+                num_dig++;
+            }
+        }
+        else
+        {
+            exp10++;
+        }
+    }
+    if ( c < tok_end && *c == '.' )
+    {
+        for ( c++ ; c < tok_end && *c >= '0' && *c <= '9' ; c++ )
+        {
+            dig_flag = true;
+            if ( num_dig < 19 )
+            {
+                mant = mant * 10 + ( *c - '0' );
+                if ( mant )
+                {
+                    num_dig++;
+                }
+                exp10--;
+            }
+        }
+    }
+    if ( dig_flag && c < tok_end && ( *c == 'e' || *c == 'E' ) )
+    {
+        c++;
+        bool eneg = false;
+        if ( c < tok_end && ( *c == '-' || *c == '+' ) )
+        {
+            eneg = ( *c == '-' );
+            c++;
+        }
+        int e = 0;
+        for ( ; c < tok_end && *c >= '0' && *c <= '9' ; c++ )
+        {
+            if ( e < 10000 )
+            {
+                e = e * 10 + ( *c - '0' );
+            }
+        }
+        exp10 += eneg ? -e : e;
+    }
+
+    if ( dig_flag && c == tok_end && ( mant >> 53 ) == 0 && exp10 >= -22 && exp10 <= 22 )
+    {
+        double v = ( double )mant;
+        v = ( exp10 < 0 ) ? v / pow10[ -exp10 ] : v * pow10[ exp10 ];
+        val = ( float )( neg ? -v : v );
+        return true;
+    }
+
+    //==== Long Mantissa, Large Exponent, Inf or NaN ====//
+    string str( tok, len );
+    char* str_end;
+    double v = strtod( str.c_str(), &str_end );
+    if ( str_end == str.c_str() )
+    {
+        return false;
+    }
+    val = ( float )v;
+    return true;
+}
+
+//==== Position Of Next "facet" Token At Or After pos - size If None ====//
+static size_t FindFacet( const char* data, size_t pos, size_t size )
+{
+    while ( pos + 5 <= size )
+    {
+        const char* f = ( const char* )memchr( data + pos, 'f', size - pos );
+        if ( !f )
+        {
+            break;
+        }
+        size_t i = ( size_t )( f - data );
+        if ( i + 5 <= size && strncmp( f, "facet", 5 ) == 0 &&
+                ( i == 0 || IsSpace( data[i - 1] ) ) && ( i + 5 == size || IsSpace( data[i + 5] ) ) )
+        {
+            return i;
+        }
+        pos = i + 1;
+    }
+    return size;
+}
+
+//==== Parse One Facet Starting At "facet" Token ====//
+static bool ParseFacet( const char* & p, const char* end, float* norm, float* pnt )
+{
+    int len;
+    const char* tok = NextToken( p, end, len );           // facet
+    p = tok + len;
+
+    tok = NextToken( p, end, len );
+    if ( !TokenIs( tok, len, "normal" ) )
+    {
+        return false;
+    }
+    p = tok + len;
+
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        if ( !ParseFloat( p, end, norm[i] ) )
+        {
+            return false;
+        }
+    }
+
+    int num_vert = 0;
+    while ( num_vert < 3 )
+    {
+        tok = NextToken( p, end, len );
+        if ( len == 0 || TokenIs( tok, len, "endfacet" ) )
+        {
+            return false;
+        }
+        p = tok + len;
+
+        if ( TokenIs( tok, len, "vertex" ) )
+        {
+            for ( int i = 0 ; i < 3 ; i++ )
+            {
+                if ( !ParseFloat( p, end, pnt[ 3 * num_vert + i ] ) )
+                {
+                    return false;
+                }
+            }
+            num_vert++;
+        }
+    }
+    return true;
+}
+
+//===============================================//
+//                  StlFile
+//===============================================//
+StlFile::StlFile()
+{
+    m_BinaryFlag = false;
+}
+
+StlFile::~StlFile()
+{
+}
+
+void StlFile::Clear()
+{
+    m_BinaryFlag = false;
+    vector< float >().swap( m_NormVec );
+    vector< float >().swap( m_PntVec );
+    vector< float >().swap( m_NodePntVec );
+    vector< int >().swap( m_TriNodeVec );
+}
+
+bool StlFile::Read( const string & file_name )
+{
+    MappedFile file;
+    if ( !file.Open( file_name ) )
+    {
+        Clear();
+        return false;
+    }
+    return Read( file.GetData(), file.GetSize() );
+}
+
+bool StlFile::Read( const char* data, size_t size )
+{
+    Clear();
+
+    if ( !data || size == 0 )
+    {
+        return true;
+    }
+
+    //==== Binary Headers May Also Start With "solid" - Trust Size First ====//
+    if ( IsBinarySize( data, size ) )
+    {
+        ReadBinary( data, size );
+        return true;
+    }
+
+    int len;
+    const char* tok = NextToken( data, data + size, len );
+    if ( !TokenIs( tok, len, "solid" ) && size >= BIN_HEADER_SIZE )
+    {
+        ReadBinary( data, size );
+        return true;
+    }
+
+    ReadASCII( data, size );
+    return true;
+}
+
+bool StlFile::IsBinarySize( const char* data, size_t size )
+{
+    if ( size < BIN_HEADER_SIZE )
+    {
+        return false;
+    }
+    unsigned long long num_facet = ReadLEUInt( data + 80 );
+    return BIN_HEADER_SIZE + BIN_FACET_SIZE * num_facet == size;
+}
+
+void StlFile::ReadBinary( const char* data, size_t size )
+{
+    m_BinaryFlag = true;
+
+    //==== Truncated Files Keep Whole Facets Only ====//
+    long long num_facet = ReadLEUInt( data + 80 );
+    num_facet = std::min( num_facet, ( long long )( ( size - BIN_HEADER_SIZE ) / BIN_FACET_SIZE ) );
+
+    m_NormVec.resize( 3 * num_facet );
+    m_PntVec.resize( 9 * num_facet );
+
+    #pragma omp parallel for
+    for ( long long f = 0 ; f < num_facet ; f++ )
+    {
+        const char* p = data + BIN_HEADER_SIZE + BIN_FACET_SIZE * f;
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            m_NormVec[ 3 * f + i ] = ReadLEFloat( p + 4 * i );
+        }
+        for ( int i = 0 ; i < 9 ; i++ )
+        {
+            m_PntVec[ 9 * f + i ] = ReadLEFloat( p + 12 + 4 * i );
+        }
+    }
+}
+
+void StlFile::ReadASCII( const char* data, size_t size )
+{
+    m_BinaryFlag = false;
+
+    //==== Chunks Start On A "facet" Token - Each Parses The Facets Starting Inside It ====//
+    int num_chunk = 1;
+    if ( size > ASCII_CHUNK_SIZE )
+    {
+        num_chunk = ( int )std::min( ( size_t )( 8 * GetMaxNumThreads() ), size / ASCII_CHUNK_SIZE );
+        num_chunk = std::max( num_chunk, 1 );
+    }
+
+    vector< size_t > start_vec( num_chunk + 1 );
+    start_vec[0] = FindFacet( data, 0, size );
+    for ( int c = 1 ; c < num_chunk ; c++ )
+    {
+        size_t pos = std::max( ( size_t )( ( double )size * c / num_chunk ), start_vec[c - 1] );
+        start_vec[c] = FindFacet( data, pos, size );
+    }
+    start_vec[ num_chunk ] = size;
+
+    vector< vector< float > > norm_chunk_vec( num_chunk );
+    vector< vector< float > > pnt_chunk_vec( num_chunk );
+
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for ( int c = 0 ; c < num_chunk ; c++ )
+    {
+        const char* end = data + size;
+        size_t pos = start_vec[c];
+        while ( pos < start_vec[c + 1] )
+        {
+            const char* p = data + pos;
+            float norm[3];
+            float pnt[9];
+            if ( ParseFacet( p, end, norm, pnt ) )
+            {
+                norm_chunk_vec[c].insert( norm_chunk_vec[c].end(), norm, norm + 3 );
+                pnt_chunk_vec[c].insert( pnt_chunk_vec[c].end(), pnt, pnt + 9 );
+            }
+            else
+            {
+                p = data + pos + 5;
+            }
+            pos = FindFacet( data, ( size_t )( p - data ), size );
+        }
+    }
+
+    //==== Join Chunks In File Order ====//
+    vector< size_t > offset_vec( num_chunk + 1, 0 );
+    for ( int c = 0 ; c < num_chunk ; c++ )
+    {
+        offset_vec[c + 1] = offset_vec[c] + norm_chunk_vec[c].size() / 3;
+    }
+
+    m_NormVec.resize( 3 * offset_vec[ num_chunk ] );
+    m_PntVec.resize( 9 * offset_vec[ num_chunk ] );
+
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for ( int c = 0 ; c < num_chunk ; c++ )
+    {
+        std::copy( norm_chunk_vec[c].begin(), norm_chunk_vec[c].end(), m_NormVec.begin() + 3 * offset_vec[c] );
+        std::copy( pnt_chunk_vec[c].begin(), pnt_chunk_vec[c].end(), m_PntVec.begin() + 9 * offset_vec[c] );
+        vector< float >().swap( norm_chunk_vec[c] );
+        vector< float >().swap( pnt_chunk_vec[c] );
+    }
+}
+
+void StlFile::Weld()
+{
+    long long num_pnt = ( long long )m_PntVec.size() / 3;
+
+    m_NodePntVec.clear();
+    m_TriNodeVec.assign( num_pnt, -1 );
+
+    //==== Open Addressing Table Of Point Indices - At Most Half Full ====//
+    long long table_size = 1;
+    while ( table_size < 2 * num_pnt )
+    {
+        table_size *= 2;
+    }
+    unsigned int mask = ( unsigned int )( table_size - 1 );
+
+    //==== Hash Coordinate Bits - Negative Zero Matches Zero ====//
+    vector< unsigned int > hash_vec( num_pnt );
+
+    #pragma omp parallel for
+    for ( long long i = 0 ; i < num_pnt ; i++ )
+    {
+        unsigned int h = 2166136261u;
+        for ( int a = 0 ; a < 3 ; a++ )
+        {
+            float f = m_PntVec[ 3 * i + a ];
+            if ( f == 0.0f )
+            {
+                f = 0.0f;
+            }
+            unsigned int u;
+            memcpy( &u, &f, sizeof( u ) );
+            h = ( h ^ u ) * 16777619u;
+            h ^= h >> 15;
+        }
+        hash_vec[i] = h;
+    }
+
+    //==== First Occurrence Of Each Coordinate Becomes The Node - Keeps File Order ====//
+    vector< int > table( table_size, -1 );
+    for ( long long i = 0 ; i < num_pnt ; i++ )
+    {
+        const float* p = &m_PntVec[ 3 * i ];
+        unsigned int h = hash_vec[i] & mask;
+        while ( true )
+        {
+            int j = table[h];
+            if ( j < 0 )
+            {
+                table[h] = ( int )i;
+                m_TriNodeVec[i] = ( int )( m_NodePntVec.size() / 3 );
+                m_NodePntVec.insert( m_NodePntVec.end(), p, p + 3 );
+                break;
+            }
+
+            const float* q = &m_PntVec[ 3 * j ];
+            if ( p[0] == q[0] && p[1] == q[1] && p[2] == q[2] )
+            {
+                m_TriNodeVec[i] = m_TriNodeVec[j];
+                break;
+            }
+            h = ( h + 1 ) & mask;
+        }
+    }
+
+    vector< float >().swap( m_PntVec );
+}
@@ -0,0 +1,68 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// StlFile.h: Stereolithography file reader - mapped, parallel parse and vertex weld.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_STL_FILE__INCLUDED_)
+#define VSP_STL_FILE__INCLUDED_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+//////////////////////////////////////////////////////////////////////
+//==== Binary Files Are Recognized By Header Facet Count And File Size, ====//
+//==== ASCII Facets Are Parsed In Chunks On Multiple Threads.  Facets   ====//
+//==== Keep File Order.  Weld Merges Vertices With Identical Coords.    ====//
+class StlFile
+{
+public:
+
+    StlFile();
+    virtual ~StlFile();
+
+    void Clear();
+
+    //==== Returns False If File Can Not Be Read ====//
+    bool Read( const string & file_name );
+    bool Read( const char* data, size_t size );
+
+    //==== Build m_NodePntVec and m_TriNodeVec, Then Free m_PntVec ====//
+    void Weld();
+
+    int GetNumFacets() const
+    {
+        return ( int )m_NormVec.size() / 3;
+    }
+    int GetNumNodes() const
+    {
+        return ( int )m_NodePntVec.size() / 3;
+    }
+    bool IsBinary() const
+    {
+        return m_BinaryFlag;
+    }
+
+    vector< float > m_NormVec;          // 3 Per Facet
+    vector< float > m_PntVec;           // 9 Per Facet - Empty After Weld
+
+    vector< float > m_NodePntVec;       // 3 Per Unique Vertex
+    vector< int > m_TriNodeVec;         // 3 Per Facet
+
+protected:
+
+    static bool IsBinarySize( const char* data, size_t size );
+
+    void ReadBinary( const char* data, size_t size );
+    void ReadASCII( const char* data, size_t size );
+
+    bool m_BinaryFlag;
+};
+
+#endif
@@ -8,8 +8,15 @@
 #include "UtilTestSuite.h"
 
 #include <float.h>
+#include <climits>
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "PntHash.h"
+#include "StlFile.h"
+#include "WriteBuffer.h"
+#include "CompressUtil.h"
+#include <algorithm>
+#include <cstring>
 
 
 //==== Test vec2d ====//
@@ -665,3 +672,285 @@ void UtilTestSuite::BilinearInterpTest()
     TEST_ASSERT_DELTA( interp_val, 9.8125, DBL_EPSILON );
 
 }
+
+void UtilTestSuite::PntHashTest()
+{
+    //==== Duplicates, A Point Within Tol and A Point Just Outside Tol ====//
+    vector< vec3d > pnts;
+    pnts.push_back( vec3d( 1.0, 2.0, 3.0 ) );
+    pnts.push_back( vec3d( 4.0, 5.0, 6.0 ) );
+    pnts.push_back( vec3d( 1.0, 2.0, 3.0 ) );
+    pnts.push_back( vec3d( 4.0 + 1.0e-13, 5.0, 6.0 ) );
+    pnts.push_back( vec3d( 4.0, 5.0, 6.0 + 1.0e-9 ) );
+    pnts.push_back( vec3d( -7.0, 0.5, 0.0 ) );
+
+    vector< vec3d* > pnt_ptrs;
+    for ( int i = 0 ; i < ( int )pnts.size() ; i++ )
+    {
+        pnt_ptrs.push_back( &pnts[i] );
+    }
+
+    PntHash hash;
+    hash.Build( pnt_ptrs, 1.0e-12 );
+
+    TEST_ASSERT( hash.GetNumUnique() == 4 );
+    TEST_ASSERT( hash.IsUnique( 0 ) && hash.IsUnique( 1 ) && hash.IsUnique( 4 ) && hash.IsUnique( 5 ) );
+    TEST_ASSERT( !hash.IsUnique( 2 ) && !hash.IsUnique( 3 ) );
+    TEST_ASSERT( hash.FindMatch( pnts[2] ) == 0 );
+    TEST_ASSERT( hash.FindMatch( pnts[3] ) == 1 );
+    TEST_ASSERT( hash.FindMatch( pnts[4] ) == 4 );
+    TEST_ASSERT( hash.FindMatch( vec3d( 10.0, 10.0, 10.0 ) ) == -1 );
+
+    //==== All Matches Include Non Unique Points ====//
+    vector< int > match_vec;
+    hash.FindAllMatches( pnts[1], match_vec );
+    std::sort( match_vec.begin(), match_vec.end() );
+    TEST_ASSERT( match_vec.size() == 2 && match_vec[0] == 1 && match_vec[1] == 3 );
+
+    hash.BuildGrid( pnt_ptrs, 1.0e-6 );
+    hash.FindAllMatches( pnts[1], match_vec );
+    TEST_ASSERT( match_vec.size() == 3 );
+
+    //==== Points On A Curved Sheet, Each Referenced By Several Tris ====//
+    int num_side = 100;
+    int num_ref = 6;
+    vector< vec3d > sheet;
+    for ( int i = 0 ; i < num_side ; i++ )
+    {
+        for ( int j = 0 ; j < num_side ; j++ )
+        {
+            double u = ( double )i / ( double )num_side;
+            double w = ( double )j / ( double )num_side;
+            sheet.push_back( vec3d( 5.0 * u, 30.0 * w, 0.5 * sin( 2.0 * M_PI * u ) ) );
+        }
+    }
+
+    vector< vec3d* > sheet_ptrs;
+    for ( int k = 0 ; k < num_ref ; k++ )
+    {
+        for ( int i = 0 ; i < ( int )sheet.size() ; i++ )
+        {
+            sheet_ptrs.push_back( &sheet[ ( i * 7919 + k ) % sheet.size() ] );
+        }
+    }
+
+    hash.Build( sheet_ptrs, 1.0e-12 );
+    TEST_ASSERT( hash.GetNumUnique() == ( int )sheet.size() );
+
+    bool match_flag = true;
+    for ( int i = 0 ; i < ( int )sheet_ptrs.size() ; i++ )
+    {
+        int ind = hash.FindMatch( *sheet_ptrs[i] );
+        if ( ind < 0 || ind > i || sheet_ptrs[ind] != sheet_ptrs[i] )
+        {
+            match_flag = false;
+        }
+    }
+    TEST_ASSERT( match_flag );
+
+    //==== Dense Cluster Far From One Outlier - Cells Follow Tol, Not The Bounding Box ====//
+    vector< vec3d > cluster;
+    for ( int i = 0 ; i < 2000 ; i++ )
+    {
+        cluster.push_back( vec3d( 1.0e-6 * i, 2.0e-6 * ( i % 7 ), 0.0 ) );
+    }
+    cluster.push_back( vec3d( 1.0e4, 1.0e4, 1.0e4 ) );
+    cluster.push_back( cluster[5] + vec3d( 0.0, 0.0, 1.0e-8 ) );
+
+    vector< vec3d* > cluster_ptrs;
+    for ( int i = 0 ; i < ( int )cluster.size() ; i++ )
+    {
+        cluster_ptrs.push_back( &cluster[i] );
+    }
+
+    hash.Build( cluster_ptrs, 1.0e-7 );
+    TEST_ASSERT( hash.GetNumUnique() == ( int )cluster.size() - 1 );
+    TEST_ASSERT( hash.FindMatch( cluster.back() ) == 5 );
+    TEST_ASSERT( hash.FindMatch( vec3d( 1.0e4, 1.0e4, 1.0e4 ) ) == 2000 );
+}
+
+//==== Write One Float Little Endian Into A Binary STL Buffer ====//
+static void AppendLEFloat( string & buf, float f )
+{
+    unsigned int u;
+    memcpy( &u, &f, sizeof( u ) );
+    for ( int i = 0 ; i < 4 ; i++ )
+    {
+        buf.push_back( ( char )( ( u >> ( 8 * i ) ) & 0xff ) );
+    }
+}
+
+void UtilTestSuite::StlFileTest()
+{
+    //==== Unit Square As Two Tris Sharing An Edge ====//
+    float pnts[2][9] = { { 0, 0, 0,   1, 0, 0,   1, 1, 0 },
+                         { 0, 0, 0,   1, 1, 0,   0, 1, 0 } };
+
+    string ascii = "solid square\n";
+    for ( int t = 0 ; t < 2 ; t++ )
+    {
+        char str[256];
+        ascii += "  facet normal 0 0 1.0e+00\n    outer loop\n";
+        for ( int v = 0 ; v < 3 ; v++ )
+        {
+            snprintf( str, sizeof( str ), "      vertex %g %g %g\n", pnts[t][3 * v], pnts[t][3 * v + 1], pnts[t][3 * v + 2] );
+            ascii += str;
+        }
+        ascii += "    endloop\n  endfacet\n";
+    }
+    ascii += "endsolid square\n";
+
+    //==== Header Starting With "solid" Must Still Be Read As Binary ====//
+    string binary( 80, ' ' );
+    binary.replace( 0, 5, "solid" );
+    binary.push_back( 2 );
+    binary.append( 3, '\0' );
+    for ( int t = 0 ; t < 2 ; t++ )
+    {
+        AppendLEFloat( binary, 0.0f );
+        AppendLEFloat( binary, 0.0f );
+        AppendLEFloat( binary, 1.0f );
+        for ( int i = 0 ; i < 9 ; i++ )
+        {
+            AppendLEFloat( binary, pnts[t][i] );
+        }
+        binary.append( 2, '\0' );
+    }
+
+    StlFile stl_ascii;
+    StlFile stl_binary;
+    TEST_ASSERT( stl_ascii.Read( ascii.c_str(), ascii.size() ) );
+    TEST_ASSERT( stl_binary.Read( binary.c_str(), binary.size() ) );
+
+    TEST_ASSERT( !stl_ascii.IsBinary() );
+    TEST_ASSERT( stl_binary.IsBinary() );
+    TEST_ASSERT( stl_ascii.GetNumFacets() == 2 );
+    TEST_ASSERT( stl_binary.GetNumFacets() == 2 );
+    TEST_ASSERT( stl_ascii.m_PntVec == stl_binary.m_PntVec );
+    TEST_ASSERT( stl_ascii.m_NormVec == stl_binary.m_NormVec );
+    TEST_ASSERT_DELTA( stl_ascii.m_NormVec[2], 1.0, DBL_EPSILON );
+
+    //==== Shared Edge Vertices Weld To The Same Nodes ====//
+    stl_ascii.Weld();
+    TEST_ASSERT( stl_ascii.GetNumNodes() == 4 );
+    TEST_ASSERT( stl_ascii.m_PntVec.empty() );
+    TEST_ASSERT( stl_ascii.m_TriNodeVec[0] == stl_ascii.m_TriNodeVec[3] );
+    TEST_ASSERT( stl_ascii.m_TriNodeVec[2] == stl_ascii.m_TriNodeVec[4] );
+
+    //==== Truncated Last Facet Is Skipped ====//
+    string bad = ascii.substr( 0, ascii.rfind( "vertex" ) );
+    TEST_ASSERT( stl_ascii.Read( bad.c_str(), bad.size() ) );
+    TEST_ASSERT( stl_ascii.GetNumFacets() == 1 );
+}
+
+void UtilTestSuite::WriteBufferTest()
+{
+    //==== Formatted Text Must Match printf Exactly ====//
+    vector< double > vals;
+    double special[] = { 0.0, -0.0, 1.0, -1.0, 0.5, 2.5, 0.1, 1.0e-5, 1.0e-4, 99999.5, 9.99999999995,
+                         123456789012.0, 6.123233995736766e-17, 1.0e200, -4.9e-324, 1.0e100 * 1.0e300
+                       };
+    vals.insert( vals.end(), special, special + sizeof( special ) / sizeof( special[0] ) );
+
+    srand( 17 );
+    for ( int i = 0 ; i < 20000 ; i++ )
+    {
+        double mant = 2.0 * ( double )rand() / ( double )RAND_MAX - 1.0;
+        vals.push_back( mant * pow( 10.0, ( i % 61 ) - 30 ) );
+        vals.push_back( ( double )( rand() % 2000001 - 1000000 ) / pow( 10.0, i % 7 ) );
+    }
+
+    int num_bad = 0;
+    char str[512];
+    for ( int i = 0 ; i < ( int )vals.size() ; i++ )
+    {
+        WriteBuffer buf;
+        buf.AppendExp( vals[i], 10 );
+        buf.Append( " ", 1 );
+        buf.AppendGen( vals[i], 16, 10 );
+
+        snprintf( str, sizeof( str ), "%2.10le %16.10g", vals[i], vals[i] );
+        if ( string( buf.GetData(), buf.GetSize() ) != str )
+        {
+            num_bad++;
+        }
+    }
+    TEST_ASSERT( num_bad == 0 );
+
+    //==== Integers Over The Full int Range ====//
+    vector< int > ints;
+    int special_ints[] = { 0, 1, -1, 9, 10, -10, 99, 100, 123456789, -1000000000, INT_MAX, INT_MAX - 1, INT_MIN, INT_MIN + 1 };
+    ints.insert( ints.end(), special_ints, special_ints + sizeof( special_ints ) / sizeof( special_ints[0] ) );
+    for ( int i = 0 ; i < 20000 ; i++ )
+    {
+        unsigned int bits = ( ( unsigned int )rand() << 16 ) ^ ( unsigned int )rand();
+        int mag = ( int )( ( bits & INT_MAX ) >> ( i % 31 ) );
+        ints.push_back( ( i % 2 ) ? -mag : mag );
+    }
+
+    num_bad = 0;
+    for ( int i = 0 ; i < ( int )ints.size() ; i++ )
+    {
+        WriteBuffer buf;
+        buf.AppendInt( ints[i] );
+
+        snprintf( str, sizeof( str ), "%d", ints[i] );
+        if ( string( buf.GetData(), buf.GetSize() ) != str )
+        {
+            num_bad++;
+        }
+    }
+    TEST_ASSERT( num_bad == 0 );
+
+    //==== Binary Values ====//
+    WriteBuffer bin;
+    bin.AppendBinInt( 0x01020304 );
+    bin.AppendBinInt( 0x01020304, true );
+    bin.AppendBinFloat( 1.0f );
+    const unsigned char expect[] = { 4, 3, 2, 1, 1, 2, 3, 4, 0, 0, 0x80, 0x3f };
+    TEST_ASSERT( bin.GetSize() == sizeof( expect ) );
+    TEST_ASSERT( memcmp( bin.GetData(), expect, sizeof( expect ) ) == 0 );
+}
+
+void UtilTestSuite::CompressUtilTest()
+{
+    //==== Base64 - RFC 4648 Test Vectors ====//
+    const char* plain[] = { "", "f", "fo", "foo", "foob", "fooba", "foobar" };
+    const char* coded[] = { "", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+    for ( int i = 0 ; i < 7 ; i++ )
+    {
+        TEST_ASSERT( Base64Encode( ( const unsigned char* )plain[i], strlen( plain[i] ) ) == coded[i] );
+
+        vector< unsigned char > dec;
+        TEST_ASSERT( Base64Decode( coded[i], strlen( coded[i] ), dec ) );
+        TEST_ASSERT( string( dec.begin(), dec.end() ) == plain[i] );
+    }
+
+    vector< unsigned char > dec;
+    TEST_ASSERT( Base64Decode( "Zm9v\n  YmFy\n", 12, dec ) );
+    TEST_ASSERT( string( dec.begin(), dec.end() ) == "foobar" );
+    TEST_ASSERT( !Base64Decode( "Zm9v*mFy", 8, dec ) );
+
+    //==== Shuffle And Compress Doubles, Then Restore Exactly ====//
+    vector< double > dvec( 3000 );
+    for ( int i = 0 ; i < ( int )dvec.size() ; i++ )
+    {
+        dvec[i] = sin( 0.01 * i ) * 10.0;
+    }
+    size_t size = dvec.size() * sizeof( double );
+
+    vector< unsigned char > shuf( size );
+    ShuffleBytes( ( const unsigned char* )&dvec[0], dvec.size(), sizeof( double ), &shuf[0] );
+
+    vector< unsigned char > comp;
+    TEST_ASSERT( ZlibCompress( &shuf[0], size, comp ) );
+    TEST_ASSERT( comp.size() < size );
+
+    vector< unsigned char > unz( size );
+    TEST_ASSERT( ZlibDecompress( &comp[0], comp.size(), size, &unz[0] ) );
+    TEST_ASSERT( !ZlibDecompress( &comp[0], comp.size() / 2, size, &unz[0] ) );
+
+    vector< double > back( dvec.size() );
+    UnshuffleBytes( &unz[0], dvec.size(), sizeof( double ), ( unsigned char* )&back[0] );
+    TEST_ASSERT( memcmp( &back[0], &dvec[0], size ) == 0 );
+}
@@ -36,6 +36,10 @@ public:
         TEST_ADD( UtilTestSuite::SharedPtrTest )
         TEST_ADD( UtilTestSuite::PointInPolyTest )
         TEST_ADD( UtilTestSuite::BilinearInterpTest )
+        TEST_ADD( UtilTestSuite::PntHashTest )
+        TEST_ADD( UtilTestSuite::StlFileTest )
+        TEST_ADD( UtilTestSuite::WriteBufferTest )
+        TEST_ADD( UtilTestSuite::CompressUtilTest )
     }
 
 private:
@@ -48,6 +52,10 @@ private:
     void SharedPtrTest();
     void PointInPolyTest();
     void BilinearInterpTest();
+    void PntHashTest();
+    void StlFileTest();
+    void WriteBufferTest();
+    void CompressUtilTest();
 
     void WritePntVecs( vector< vector< vec3d > > & pnt_vecs,  string file_name );
     void WriteCurve( VspCurve& crv, string file_name );
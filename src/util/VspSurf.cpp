@@ -18,6 +18,7 @@
 #include "StlHelper.h"
 #include "PntNodeMerge.h"
 #include "Cluster.h"
+#include "ContentHash.h"
 
 #include "eli/geom/surface/piecewise_body_of_revolution_creator.hpp"
 #include "eli/geom/surface/piecewise_multicap_surface_creator.hpp"
@@ -70,6 +71,93 @@ int VspSurf::GetNumSectW() const
     return m_Surface.number_v_patches();
 }
 
+void VspSurf::AddToHash( ContentHash & hash ) const
+{
+    hash.Add( ( int )m_FlipNormal );
+    hash.Add( ( int )m_MagicVParm );
+    hash.Add( m_SurfType );
+    hash.Add( m_SurfCfdType );
+
+    piecewise_surface_type::index_type ip, jp, nupatch, nvpatch;
+    nupatch = m_Surface.number_u_patches();
+    nvpatch = m_Surface.number_v_patches();
+
+    hash.Add( ( int )nupatch );
+    hash.Add( ( int )nvpatch );
+
+    vector< double > pmap;
+    m_Surface.get_pmap_u( pmap );
+    for ( int i = 0 ; i < ( int )pmap.size() ; i++ )
+    {
+        hash.Add( pmap[i] );
+    }
+    m_Surface.get_pmap_v( pmap );
+    for ( int i = 0 ; i < ( int )pmap.size() ; i++ )
+    {
+        hash.Add( pmap[i] );
+    }
+
+    for( ip = 0; ip < nupatch; ++ip )
+    {
+        for( jp = 0; jp < nvpatch; ++jp )
+        {
+            surface_patch_type::index_type icp, jcp;
+            const surface_patch_type *patch = m_Surface.get_patch( ip, jp );
+
+            hash.Add( ( int )patch->degree_u() );
+            hash.Add( ( int )patch->degree_v() );
+
+            for( icp = 0; icp <= patch->degree_u(); ++icp )
+            {
+                for( jcp = 0; jcp <= patch->degree_v(); ++jcp )
+                {
+                    surface_point_type cp;
+                    cp = patch->get_control_point( icp, jcp );
+                    hash.Add( cp.x() );
+                    hash.Add( cp.y() );
+                    hash.Add( cp.z() );
+                }
+            }
+        }
+    }
+
+    hash.Add( ( int )m_UFeature.size() );
+    for ( int i = 0 ; i < ( int )m_UFeature.size() ; i++ )
+    {
+        hash.Add( m_UFeature[i] );
+    }
+    hash.Add( ( int )m_WFeature.size() );
+    for ( int i = 0 ; i < ( int )m_WFeature.size() ; i++ )
+    {
+        hash.Add( m_WFeature[i] );
+    }
+
+    hash.Add( ( int )m_USkip.size() );
+    for ( int i = 0 ; i < ( int )m_USkip.size() ; i++ )
+    {
+        hash.Add( ( int )m_USkip[i] );
+    }
+    hash.Add( ( int )m_WSkip.size() );
+    for ( int i = 0 ; i < ( int )m_WSkip.size() ; i++ )
+    {
+        hash.Add( ( int )m_WSkip[i] );
+    }
+
+    hash.Add( m_LECluster );
+    hash.Add( m_TECluster );
+
+    hash.Add( ( int )m_RootCluster.size() );
+    for ( int i = 0 ; i < ( int )m_RootCluster.size() ; i++ )
+    {
+        hash.Add( m_RootCluster[i] );
+    }
+    hash.Add( ( int )m_TipCluster.size() );
+    for ( int i = 0 ; i < ( int )m_TipCluster.size() ; i++ )
+    {
+        hash.Add( m_TipCluster[i] );
+    }
+}
+
 double VspSurf::GetUMax() const
 {
   return m_Surface.get_umax();
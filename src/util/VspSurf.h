@@ -41,6 +41,8 @@ typedef eli::geom::surface::connection_data<double, 3, surface_tolerance_type> r
 #include <string>
 using std::vector;
 
+class ContentHash;
+
 class VspSurf
 {
 public:
@@ -181,6 +183,9 @@ public:
     int GetNumSectU() const;
     int GetNumSectW() const;
 
+    //==== Everything Tesselation Depends On - Surface, Flags, Features and Clustering ====//
+    void AddToHash( ContentHash & hash ) const;
+
 protected:
 
     void Tesselate( const vector<double> &utess, const vector<double> &vtess, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const;
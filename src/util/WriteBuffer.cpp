@@ -0,0 +1,314 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// WriteBuffer.cpp: Text and binary output formatted in memory, written in large blocks.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "WriteBuffer.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+//==== Powers Of Ten Exact In Double ====//
+static const double s_Pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+                                };
+
+//==== Largest Significant Digit Count Handled Without snprintf ====//
+static const int MAX_FAST_DIGITS = 14;
+
+//==== a * 10^k With At Most Two Roundings ====//
+static inline double ScalePow10( double a, int k )
+{
+    if ( k >= 0 )
+    {
+        if ( k > 22 )
+        {
+            return ( a * s_Pow10[22] ) * s_Pow10[ k - 22 ];
+        }
+        return a * s_Pow10[k];
+    }
+    k = -k;
+    if ( k > 22 )
+    {
+        return ( a / s_Pow10[22] ) / s_Pow10[ k - 22 ];
+    }
+    return a / s_Pow10[k];
+}
+
+//==== Round Positive a To num_dig Significant Digits - mant Has Exactly num_dig Digits ====//
+//==== And a ~= mant * 10^( exp10 - num_dig + 1 ).  False When Too Close To A Tie To Tell ====//
+static bool RoundDigits( double a, int num_dig, unsigned long long & mant, int & exp10 )
+{
+    double lo = s_Pow10[ num_dig - 1 ];
+    double hi = s_Pow10[ num_dig ];
+
+    //==== Scaled Value Is Within Two Roundings Of Exact ====//
+    double tol = hi * 1.0e-15;
+
+    int e = ( int )floor( log10( a ) );
+    for ( int iter = 0 ; iter < 3 ; iter++ )
+    {
+        int k = num_dig - 1 - e;
+        if ( k > 44 || k < -44 )
+        {
+            return false;
+        }
+
+        double s = ScalePow10( a, k );
+        if ( s < lo )
+        {
+            e--;
+            continue;
+        }
+        if ( s >= hi )
+        {
+            e++;
+            continue;
+        }
+
+        double r = floor( s );
+        double frac = s - r;
+        if ( fabs( frac - 0.5 ) < tol )
+        {
+            return false;
+        }
+
+        mant = ( unsigned long long )r + ( frac > 0.5 ? 1 : 0 );
+        if ( mant >= ( unsigned long long )hi )
+        {
+            mant /= 10;
+            e++;
+        }
+        exp10 = e;
+        return true;
+    }
+    return false;
+}
+
+//==== Exponent As printf Writes It - Sign And At Least Two Digits ====//
+static inline int FormatExponent( int e, char* str )
+{
+    int n = 0;
+    str[n++] = 'e';
+    str[n++] = ( e < 0 ) ? '-' : '+';
+    e = abs( e );
+    if ( e >= 100 )
+    {
+        str[n++] = ( char )( '0' + e / 100 );
+        e %= 100;
+    }
+    str[n++] = ( char )( '0' + e / 10 );
+    str[n++] = ( char )( '0' + e % 10 );
+    return n;
+}
+
+static inline void MantissaDigits( unsigned long long mant, int num_dig, char* dig )
+{
+    for ( int i = num_dig - 1 ; i >= 0 ; i-- )
+    {
+        dig[i] = ( char )( '0' + mant % 10 );
+        mant /= 10;
+    }
+}
+
+//===============================================//
+//                  WriteBuffer
+//===============================================//
+WriteBuffer::WriteBuffer()
+{
+}
+
+WriteBuffer::~WriteBuffer()
+{
+}
+
+void WriteBuffer::Clear()
+{
+    m_Buf.clear();
+}
+
+void WriteBuffer::Reserve( size_t size )
+{
+    m_Buf.reserve( size );
+}
+
+void WriteBuffer::Append( const char* str )
+{
+    m_Buf.append( str );
+}
+
+void WriteBuffer::Append( const char* str, size_t len )
+{
+    m_Buf.append( str, len );
+}
+
+void WriteBuffer::AppendInt( int val )
+{
+    char str[16];
+    int n = sizeof( str );
+
+    long long v = val;
+    bool neg = v < 0;
+    if ( neg )
+    {
+        v = -v;
+    }
+    do
+    {
+        str[--n] = ( char )( '0' + v % 10 );
+        v /= 10;
+    }
+    while ( v );
+    if ( neg )
+    {
+        str[--n] = '-';
+    }
+    m_Buf.append( str + n, sizeof( str ) - n );
+}
+
+void WriteBuffer::AppendExp( double val, int prec )
+{
+    char str[512];
+    m_Buf.append( str, FormatExp( val, prec, str ) );
+}
+
+void WriteBuffer::AppendGen( double val, int width, int prec )
+{
+    char str[512];
+    m_Buf.append( str, FormatGen( val, width, prec, str ) );
+}
+
+void WriteBuffer::AppendBinInt( int val, bool big_endian )
+{
+    unsigned int u = ( unsigned int )val;
+    char str[4];
+    for ( int i = 0 ; i < 4 ; i++ )
+    {
+        str[ big_endian ? 3 - i : i ] = ( char )( ( u >> ( 8 * i ) ) & 0xff );
+    }
+    m_Buf.append( str, 4 );
+}
+
+void WriteBuffer::AppendBinFloat( float val, bool big_endian )
+{
+    int i;
+    memcpy( &i, &val, sizeof( i ) );
+    AppendBinInt( i, big_endian );
+}
+
+bool WriteBuffer::Write( FILE* fp ) const
+{
+    if ( m_Buf.empty() )
+    {
+        return true;
+    }
+    return fwrite( m_Buf.data(), 1, m_Buf.size(), fp ) == m_Buf.size();
+}
+
+int WriteBuffer::FormatExp( double val, int prec, char* str )
+{
+    unsigned long long mant;
+    int e;
+    if ( prec < 0 || prec + 1 > MAX_FAST_DIGITS || val == 0.0 || !std::isfinite( val ) ||
+            !RoundDigits( fabs( val ), prec + 1, mant, e ) )
+    {
+        return snprintf( str, 512, "%.*e", prec, val );
+    }
+
+    char dig[ MAX_FAST_DIGITS ];
+    MantissaDigits( mant, prec + 1, dig );
+
+    int n = 0;
+    if ( val < 0.0 )
+    {
+        str[n++] = '-';
+    }
+    str[n++] = dig[0];
+    if ( prec > 0 )
+    {
+        str[n++] = '.';
+        memcpy( str + n, dig + 1, prec );
+        n += prec;
+    }
+    n += FormatExponent( e, str + n );
+    str[n] = '\0';
+    return n;
+}
+
+int WriteBuffer::FormatGen( double val, int width, int prec, char* str )
+{
+    int num_dig = ( prec == 0 ) ? 1 : prec;
+
+    unsigned long long mant;
+    int e;
+    if ( prec < 0 || num_dig > MAX_FAST_DIGITS || width < 0 || width > 256 || val == 0.0 || !std::isfinite( val ) ||
+            !RoundDigits( fabs( val ), num_dig, mant, e ) )
+    {
+        return snprintf( str, 512, "%*.*g", width, prec, val );
+    }
+
+    char dig[ MAX_FAST_DIGITS ];
+    MantissaDigits( mant, num_dig, dig );
+
+    //==== Trailing Zeros Are Dropped, Then The Point If Nothing Follows ====//
+    int num_sig = num_dig;
+    while ( num_sig > 1 && dig[ num_sig - 1 ] == '0' )
+    {
+        num_sig--;
+    }
+
+    char body[64];
+    int n = 0;
+    if ( val < 0.0 )
+    {
+        body[n++] = '-';
+    }
+
+    if ( e < num_dig && e >= -4 )
+    {
+        if ( e >= 0 )
+        {
+            memcpy( body + n, dig, e + 1 );
+            n += e + 1;
+            if ( num_sig > e + 1 )
+            {
+                body[n++] = '.';
+                memcpy( body + n, dig + e + 1, num_sig - e - 1 );
+                n += num_sig - e - 1;
+            }
+        }
+        else
+        {
+            body[n++] = '0';
+            body[n++] = '.';
+            for ( int i = 0 ; i < -e - 1 ; i++ )
+            {
+                body[n++] = '0';
+            }
+            memcpy( body + n, dig, num_sig );
+            n += num_sig;
+        }
+    }
+    else
+    {
+        body[n++] = dig[0];
+        if ( num_sig > 1 )
+        {
+            body[n++] = '.';
+            memcpy( body + n, dig + 1, num_sig - 1 );
+            n += num_sig - 1;
+        }
+        n += FormatExponent( e, body + n );
+    }
+
+    int pad = std::max( 0, width - n );
+    memset( str, ' ', pad );
+    memcpy( str + pad, body, n );
+    str[ pad + n ] = '\0';
+    return pad + n;
+}
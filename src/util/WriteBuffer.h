@@ -0,0 +1,113 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// WriteBuffer.h: Text and binary output formatted in memory, written in large blocks.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_WRITE_BUFFER__INCLUDED_)
+#define VSP_WRITE_BUFFER__INCLUDED_
+
+#include "ParallelUtil.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+//////////////////////////////////////////////////////////////////////
+//==== Text Matches printf Byte For Byte - Values Near A Rounding Tie ====//
+//==== Or Out Of The Fast Range Are Formatted With snprintf.         ====//
+class WriteBuffer
+{
+public:
+
+    WriteBuffer();
+    virtual ~WriteBuffer();
+
+    void Clear();
+    void Reserve( size_t size );
+
+    size_t GetSize() const
+    {
+        return m_Buf.size();
+    }
+    const char* GetData() const
+    {
+        return m_Buf.data();
+    }
+
+    void Append( const char* str );
+    void Append( const char* str, size_t len );
+
+    //==== printf "%d" ====//
+    void AppendInt( int val );
+
+    //==== printf "%.<prec>e" ====//
+    void AppendExp( double val, int prec );
+
+    //==== printf "%<width>.<prec>g" ====//
+    void AppendGen( double val, int width, int prec );
+
+    //==== Raw 4 Byte Values In Requested Byte Order ====//
+    void AppendBinInt( int val, bool big_endian = false );
+    void AppendBinFloat( float val, bool big_endian = false );
+
+    //==== Returns False On Short Write ====//
+    bool Write( FILE* fp ) const;
+
+    //==== Format Items [0, num_item) In Order With format( buf, i ) On Multiple ====//
+    //==== Threads.  Output Is Written In Batches To Bound Memory.  Returns     ====//
+    //==== Number Of Bytes Written.                                             ====//
+    template < class F >
+    static size_t WriteParallel( FILE* fp, int num_item, F format );
+
+protected:
+
+    static int FormatExp( double val, int prec, char* str );
+    static int FormatGen( double val, int width, int prec, char* str );
+
+    enum { CHUNK_SIZE = 4096, CHUNKS_PER_THREAD = 4 };
+
+    string m_Buf;
+};
+
+template < class F >
+size_t WriteBuffer::WriteParallel( FILE* fp, int num_item, F format )
+{
+    int batch_chunks = CHUNKS_PER_THREAD * GetMaxNumThreads();
+    vector< WriteBuffer > buf_vec( batch_chunks );
+
+    size_t num_bytes = 0;
+    for ( int start = 0 ; start < num_item ; start += CHUNK_SIZE * batch_chunks )
+    {
+        int num_chunk = std::min( batch_chunks, ( num_item - start + CHUNK_SIZE - 1 ) / CHUNK_SIZE );
+
+        #pragma omp parallel for schedule( dynamic, 1 )
+        for ( int c = 0 ; c < num_chunk ; c++ )
+        {
+            buf_vec[c].Clear();
+            int end = std::min( num_item, start + ( c + 1 ) * CHUNK_SIZE );
+            for ( int i = start + c * CHUNK_SIZE ; i < end ; i++ )
+            {
+                format( buf_vec[c], i );
+            }
+        }
+
+        for ( int c = 0 ; c < num_chunk ; c++ )
+        {
+            if ( buf_vec[c].Write( fp ) )
+            {
+                num_bytes += buf_vec[c].GetSize();
+            }
+        }
+    }
+    return num_bytes;
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include "XmlUtil.h"
 #include "StringUtil.h"
+#include "CompressUtil.h"
 #include <cfloat>
 
 //==== Get Number of Same Names ====//
@@ -658,6 +659,139 @@ vector< vec3d > XmlUtil::GetVectorVec3dNode( xmlNodePtr node )
     return ret_vec;
 }
 
+//==== Raw Bytes Per Blob Chunk ====//
+static const size_t BLOB_CHUNK_SIZE = 1 << 20;
+
+//==== Add Binary Blob ====//
+xmlNodePtr XmlUtil::AddBlobNode( xmlNodePtr root, const char * name, const vector< unsigned char > & data )
+{
+    xmlNodePtr blob_node = xmlNewChild( root, NULL, ( const xmlChar * )name, NULL );
+    SetIntProp( blob_node, "Size", ( int )data.size() );
+
+    int num_chunk = ( int )( ( data.size() + BLOB_CHUNK_SIZE - 1 ) / BLOB_CHUNK_SIZE );
+    SetIntProp( blob_node, "Num_Chunks", num_chunk );
+
+    //==== Flags Are Written Concurrently - vector< bool > Packs Them Into Shared Words ====//
+    vector< string > str_vec( num_chunk );
+    vector< char > zlib_vec( num_chunk, 0 );
+
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for ( int c = 0 ; c < num_chunk ; c++ )
+    {
+        const unsigned char* chunk = &data[ c * BLOB_CHUNK_SIZE ];
+        size_t size = std::min( BLOB_CHUNK_SIZE, data.size() - c * BLOB_CHUNK_SIZE );
+
+        //==== Incompressible Chunks Are Stored As Is ====//
+        vector< unsigned char > comp;
+        if ( ZlibCompress( chunk, size, comp ) && comp.size() < size )
+        {
+            str_vec[c] = Base64Encode( &comp[0], comp.size() );
+            zlib_vec[c] = 1;
+        }
+        else
+        {
+            str_vec[c] = Base64Encode( chunk, size );
+        }
+    }
+
+    for ( int c = 0 ; c < num_chunk ; c++ )
+    {
+        xmlNodePtr chunk_node = xmlNewChild( blob_node, NULL, ( const xmlChar * )"Chunk", ( const xmlChar * )str_vec[c].c_str() );
+        SetIntProp( chunk_node, "Size", ( int )std::min( BLOB_CHUNK_SIZE, data.size() - c * BLOB_CHUNK_SIZE ) );
+        SetIntProp( chunk_node, "Zlib", zlib_vec[c] ? 1 : 0 );
+        string().swap( str_vec[c] );
+    }
+
+    return blob_node;
+}
+
+//==== Extract Binary Blob - False If Any Chunk Is Missing Or Corrupt ====//
+bool XmlUtil::ExtractBlobNode( xmlNodePtr node, vector< unsigned char > & data )
+{
+    data.clear();
+    if ( !node )
+    {
+        return false;
+    }
+
+    int size = FindIntProp( node, "Size", -1 );
+    if ( size < 0 )
+    {
+        return false;
+    }
+
+    //==== Chunk Text Is Read In Place When It Is A Single Text Node ====//
+    vector< const xmlChar* > text_vec;
+    vector< xmlChar* > owned_vec;
+    vector< size_t > offset_vec( 1, 0 );
+    vector< int > zlib_vec;
+    for ( xmlNodePtr iter_node = node->xmlChildrenNode ; iter_node != NULL ; iter_node = iter_node->next )
+    {
+        if ( xmlStrcmp( iter_node->name, ( const xmlChar * )"Chunk" ) )
+        {
+            continue;
+        }
+
+        xmlNodePtr text_node = iter_node->xmlChildrenNode;
+        if ( text_node && !text_node->next && text_node->type == XML_TEXT_NODE )
+        {
+            text_vec.push_back( text_node->content );
+        }
+        else
+        {
+            owned_vec.push_back( xmlNodeGetContent( iter_node ) );
+            text_vec.push_back( owned_vec.back() );
+        }
+        offset_vec.push_back( offset_vec.back() + std::max( 0, FindIntProp( iter_node, "Size", 0 ) ) );
+        zlib_vec.push_back( FindIntProp( iter_node, "Zlib", 0 ) );
+    }
+
+    bool valid = ( offset_vec.back() == ( size_t )size );
+    if ( valid )
+    {
+        data.resize( size );
+
+        #pragma omp parallel for schedule( dynamic, 1 )
+        for ( int c = 0 ; c < ( int )text_vec.size() ; c++ )
+        {
+            size_t chunk_size = offset_vec[c + 1] - offset_vec[c];
+
+            vector< unsigned char > bytes;
+            const char* text = ( const char* )text_vec[c];
+            bool chunk_valid = text && Base64Decode( text, strlen( text ), bytes );
+            if ( chunk_valid && zlib_vec[c] )
+            {
+                chunk_valid = ZlibDecompress( bytes.data(), bytes.size(), chunk_size, data.data() + offset_vec[c] );
+            }
+            else if ( chunk_valid )
+            {
+                chunk_valid = ( bytes.size() == chunk_size );
+                if ( chunk_valid && chunk_size )
+                {
+                    memcpy( data.data() + offset_vec[c], bytes.data(), chunk_size );
+                }
+            }
+
+            if ( !chunk_valid )
+            {
+                #pragma omp critical
+                valid = false;
+            }
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )owned_vec.size() ; i++ )
+    {
+        xmlFree( owned_vec[i] );
+    }
+
+    if ( !valid )
+    {
+        data.clear();
+    }
+    return valid;
+}
+
 //==== Encode File Contents ====//
 xmlNodePtr XmlUtil::EncodeFileContents( xmlNodePtr root, const char* file_name )
 {
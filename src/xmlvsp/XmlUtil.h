@@ -68,6 +68,10 @@ vec2d GetVec2dNode( xmlNodePtr node );
 vec3d GetVec3dNode( xmlNodePtr node );
 vector< vec3d > GetVectorVec3dNode( xmlNodePtr node );
 
+//==== Binary Data As Compressed Base64 Chunks - Chunks Stay Below libxml2 Text Node Limit ====//
+xmlNodePtr AddBlobNode( xmlNodePtr root, const char * name, const vector< unsigned char > & data );
+bool ExtractBlobNode( xmlNodePtr node, vector< unsigned char > & data );
+
 xmlNodePtr EncodeFileContents( xmlNodePtr root, const char* file_name );
 xmlNodePtr DecodeFileContents( xmlNodePtr root, const char* file_name );
 